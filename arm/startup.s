@@ -48,6 +48,14 @@ __isr_vector:
     .word PendSV_Handler       /* 0x38: PendSV Handler */
     .word SysTick_Handler      /* 0x3C: SysTick Handler */
 
+    /* External interrupts (LM3S6965 IRQ assignments) */
+    .word Default_IRQ_Handler  /* 0x40: IRQ 0: GPIO Port A */
+    .word Default_IRQ_Handler  /* 0x44: IRQ 1: GPIO Port B */
+    .word Default_IRQ_Handler  /* 0x48: IRQ 2: GPIO Port C */
+    .word Default_IRQ_Handler  /* 0x4C: IRQ 3: GPIO Port D */
+    .word Default_IRQ_Handler  /* 0x50: IRQ 4: GPIO Port E */
+    .word UART0_Handler        /* 0x54: IRQ 5: UART0 */
+
 /* ============================================================================
  * Reset Handler
  * ============================================================================ */
@@ -117,5 +125,7 @@ Reset_Handler:
     def_handler DebugMon_Handler
     def_handler PendSV_Handler
     def_handler SysTick_Handler
+    def_handler Default_IRQ_Handler
+    def_handler UART0_Handler
 
     .end
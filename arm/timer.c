@@ -0,0 +1,73 @@
+/**
+ * @file timer.c
+ * @brief SysTick timer driver implementation for LM3S6965
+ *
+ * Cortex-M3 SysTick registers (architectural, not chip-specific):
+ *   SYSTICK_CTRL = 0xE000E010 (Control and Status)
+ *   SYSTICK_LOAD = 0xE000E014 (Reload Value)
+ *   SYSTICK_VAL  = 0xE000E018 (Current Value)
+ */
+
+#include "timer.h"
+
+#include <stdint.h>
+
+#define SYSTICK_CTRL (*(volatile uint32_t *)0xE000E010)
+#define SYSTICK_LOAD (*(volatile uint32_t *)0xE000E014)
+#define SYSTICK_VAL (*(volatile uint32_t *)0xE000E018)
+
+#define SYSTICK_ENABLE (1 << 0)
+#define SYSTICK_TICKINT (1 << 1) /* Enable interrupt */
+#define SYSTICK_CLKSRC (1 << 2)  /* Use processor clock */
+
+#define SYSTICK_1MS (CPU_FREQ_HZ / 1000)
+#define TICKS_PER_US (CPU_FREQ_HZ / 1000000)
+
+static volatile unsigned int systick_ms = 0;
+
+/* Trace tick counter in microseconds (declared in trace.h; the weak
+ * default in anagram_chain_core.c leaves it frozen at zero) */
+extern volatile unsigned int g_trace_tick_us;
+
+void SysTick_Handler(void) {
+    systick_ms++;
+}
+
+void timer_arm_init(void) {
+    SYSTICK_LOAD = SYSTICK_1MS - 1; /* 1ms interval */
+    SYSTICK_VAL = 0;
+    SYSTICK_CTRL = SYSTICK_ENABLE | SYSTICK_TICKINT | SYSTICK_CLKSRC;
+}
+
+unsigned int timer_arm_get_ms(void) {
+    return systick_ms;
+}
+
+/* Elapsed SysTick cycles: ms counter plus the downcounter's progress
+ * through the current period. Re-reads until both halves agree so a
+ * tick interrupt between the loads cannot pair an old ms with a
+ * freshly reloaded counter. */
+static unsigned long long systick_cycles(void) {
+    unsigned int ms, val;
+
+    do {
+        ms = systick_ms;
+        val = SYSTICK_VAL;
+    } while (ms != systick_ms);
+
+    return (unsigned long long)ms * SYSTICK_1MS + (SYSTICK_1MS - 1 - val);
+}
+
+unsigned int timer_arm_get_us(void) {
+    return (unsigned int)(systick_cycles() / TICKS_PER_US);
+}
+
+unsigned long long timer_arm_get_cycles(void) {
+    return systick_cycles();
+}
+
+/* Strong override of the weak hook in anagram_chain_core.c - called by
+ * the TRACE macros and by timer_now() on ARM */
+void trace_update_time(void) {
+    g_trace_tick_us = timer_arm_get_us();
+}
@@ -0,0 +1,49 @@
+/**
+ * @file timer.h
+ * @brief SysTick timer driver for LM3S6965
+ *
+ * Free-running time base for the bare-metal target: a 1ms SysTick
+ * interrupt feeds a millisecond counter, and the current SysTick value
+ * refines reads down to cycles. Also provides the strong
+ * trace_update_time() override, so linking this driver gives TRACE
+ * timestamps and timer_now() real values without further wiring.
+ *
+ * Not used by the FreeRTOS build, where the kernel owns SysTick and
+ * main_freertos.c derives time from the RTOS tick instead.
+ */
+
+#ifndef TIMER_H
+#define TIMER_H
+
+/** CPU clock as emulated by QEMU for the lm3s6965evb machine */
+#define CPU_FREQ_HZ 12000000
+
+/**
+ * @brief Start SysTick with a 1ms period
+ *
+ * Must be called once at boot before any of the read functions.
+ */
+void timer_arm_init(void);
+
+/**
+ * @brief Milliseconds since timer_arm_init()
+ */
+unsigned int timer_arm_get_ms(void);
+
+/**
+ * @brief Microseconds since timer_arm_init()
+ *
+ * Combines the millisecond counter with the current SysTick value;
+ * wraps after about 71 minutes.
+ */
+unsigned int timer_arm_get_us(void);
+
+/**
+ * @brief CPU cycles since timer_arm_init()
+ *
+ * Derived from SysTick, so resolution is one cycle but accuracy is
+ * bounded by QEMU's instruction-batched emulation of the counter.
+ */
+unsigned long long timer_arm_get_cycles(void);
+
+#endif /* TIMER_H */
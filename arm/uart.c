@@ -23,11 +23,21 @@
 #define UART0_FBRD (*(volatile uint32_t *)(UART0_BASE + 0x028))
 #define UART0_LCRH (*(volatile uint32_t *)(UART0_BASE + 0x02C))
 #define UART0_CTL (*(volatile uint32_t *)(UART0_BASE + 0x030))
+#define UART0_IM (*(volatile uint32_t *)(UART0_BASE + 0x038))
+#define UART0_ICR (*(volatile uint32_t *)(UART0_BASE + 0x044))
 
 /* Flag Register bits */
 #define UART_FR_TXFF (1 << 5) /* TX FIFO full */
 #define UART_FR_RXFE (1 << 4) /* RX FIFO empty */
 
+/* Interrupt Mask/Clear bits */
+#define UART_INT_RX (1 << 4) /* RX FIFO trigger level */
+#define UART_INT_RT (1 << 6) /* RX timeout (trailing bytes) */
+
+/* NVIC enable register; UART0 is interrupt 5 on the LM3S6965 */
+#define NVIC_EN0 (*(volatile uint32_t *)0xE000E100)
+#define UART0_IRQ 5
+
 /* Line Control bits */
 #define UART_LCRH_WLEN_8 (0x3 << 5) /* 8-bit word length */
 #define UART_LCRH_FEN (1 << 4)      /* Enable FIFOs */
@@ -76,6 +86,120 @@ void uart_puts(const char *s) {
     }
 }
 
+void uart_write(const char *buf, unsigned len) {
+    while (len--) {
+        if (*buf == '\n') {
+            uart_putc('\r'); /* Add CR before LF for terminal compatibility */
+        }
+        uart_putc(*buf++);
+    }
+}
+
+/* ============================================================================
+ * Interrupt-driven receive
+ * ============================================================================
+ * The RX interrupt drains the hardware FIFO into a software ring, so
+ * bulk reception runs concurrently with whatever the foreground is
+ * computing. Software flow control (XON/XOFF) keeps a fast sender from
+ * overrunning the ring: XOFF goes out when the ring passes its high
+ * watermark, XON when the reader drains it back below the low one.
+ */
+
+#define RX_RING_SIZE 256 /* Power of two */
+#define RX_RING_MASK (RX_RING_SIZE - 1)
+#define RX_HIGH_WATER (RX_RING_SIZE - RX_RING_SIZE / 4)
+#define RX_LOW_WATER (RX_RING_SIZE / 4)
+
+#define XON_CHAR 0x11  /* DC1 */
+#define XOFF_CHAR 0x13 /* DC3 */
+#define EOT_CHAR 0x04  /* Ctrl-D: end of stream */
+
+static volatile unsigned char rx_ring[RX_RING_SIZE];
+static volatile unsigned rx_head; /* ISR writes here */
+static volatile unsigned rx_tail; /* Reader consumes here */
+static volatile int rx_xoff_sent;
+
+static unsigned rx_fill(void) {
+    return rx_head - rx_tail; /* Unsigned wrap keeps this correct */
+}
+
+/* RX interrupt: drain the hardware FIFO into the ring. Sending XOFF
+ * here spins on TX FIFO space, which is fine - the TX FIFO drains in
+ * microseconds and the alternative is dropping received bytes. */
+void UART0_Handler(void) {
+    UART0_ICR = UART_INT_RX | UART_INT_RT;
+
+    while (!(UART0_FR & UART_FR_RXFE)) {
+        unsigned char c = (unsigned char)UART0_DR;
+
+        if (rx_fill() < RX_RING_SIZE) {
+            rx_ring[rx_head & RX_RING_MASK] = c;
+            rx_head++;
+        }
+        /* else: ring full despite flow control - byte is dropped */
+    }
+
+    if (!rx_xoff_sent && rx_fill() >= RX_HIGH_WATER) {
+        uart_putc(XOFF_CHAR);
+        rx_xoff_sent = 1;
+    }
+}
+
+void uart_rx_start(void) {
+    rx_head = 0;
+    rx_tail = 0;
+    rx_xoff_sent = 0;
+
+    UART0_ICR = UART_INT_RX | UART_INT_RT;
+    UART0_IM = UART_INT_RX | UART_INT_RT;
+    NVIC_EN0 = (1 << UART0_IRQ);
+}
+
+int uart_getc_nonblock(void) {
+    unsigned char c;
+
+    if (rx_head == rx_tail) {
+        return -1;
+    }
+
+    c = rx_ring[rx_tail & RX_RING_MASK];
+    rx_tail++;
+
+    if (rx_xoff_sent && rx_fill() <= RX_LOW_WATER) {
+        uart_putc(XON_CHAR);
+        rx_xoff_sent = 0;
+    }
+
+    return c;
+}
+
+int uart_readline(char *buf, unsigned max) {
+    unsigned len = 0;
+
+    for (;;) {
+        int c = uart_getc_nonblock();
+
+        if (c < 0) {
+            __asm volatile("wfi"); /* Sleep until the next interrupt */
+            continue;
+        }
+
+        if (c == EOT_CHAR) {
+            return -1;
+        }
+
+        if (c == '\n' || c == '\r') {
+            buf[len] = '\0';
+            return (int)len;
+        }
+
+        if (len + 1 < max) {
+            buf[len++] = (char)c;
+        }
+        /* else: overlong line - excess bytes are dropped */
+    }
+}
+
 void uart_putint(int n) {
     char buf[12]; /* Enough for -2147483648 */
     char *p = buf + sizeof(buf) - 1;
@@ -29,10 +29,49 @@ void uart_putc(char c);
  */
 void uart_puts(const char *s);
 
+/**
+ * @brief Send a block of bytes via UART0
+ *
+ * Like uart_puts() but takes an explicit length, so callers can flush
+ * a pre-formatted buffer in one call without a terminator scan.
+ *
+ * @param buf Bytes to send
+ * @param len Number of bytes
+ */
+void uart_write(const char *buf, unsigned len);
+
 /**
  * @brief Send an integer as decimal string via UART0
  * @param n Integer to send
  */
 void uart_putint(int n);
 
+/**
+ * @brief Enable interrupt-driven receive into a software ring buffer
+ *
+ * Resets the ring and unmasks the UART0 RX interrupt. The ISR applies
+ * XON/XOFF flow control so a fast sender cannot overrun the ring.
+ * Requires the UART0 vector from startup.s (bare-metal builds).
+ */
+void uart_rx_start(void);
+
+/**
+ * @brief Take one received byte from the ring buffer
+ * @return Byte value, or -1 if the ring is empty
+ */
+int uart_getc_nonblock(void);
+
+/**
+ * @brief Receive one line, sleeping between interrupts
+ *
+ * Blocks until a CR or LF terminates the line (the terminator is not
+ * stored; CRLF shows up as a line followed by an empty one). Bytes
+ * beyond max-1 are dropped. Requires uart_rx_start().
+ *
+ * @param buf Destination, always NUL terminated
+ * @param max Size of buf
+ * @return Line length, or -1 on end of stream (Ctrl-D)
+ */
+int uart_readline(char *buf, unsigned max);
+
 #endif /* UART_H */
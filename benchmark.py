@@ -12,11 +12,23 @@ Implementations:
 
 Usage:
     python benchmark.py [dictionary] [start_word] [runs]
+    python benchmark.py --suite [--sizes 10000,100000,1000000] [--runs 3]
+                        [--json FILE] [--baseline FILE] [--threshold 0.15]
+                        [--update-baseline]
 
 Example:
     python benchmark.py tests/data/stress.txt abc 5
+    python benchmark.py --suite --sizes 10000,100000 --json results.json
+
+Suite mode sweeps dictionary sizes, records wall time and peak RSS (plus
+perf stat cache misses/IPC when `perf` is available) per implementation,
+emits machine-readable JSON, and fails if a result regresses beyond the
+threshold against a stored baseline.
 """
 
+import argparse
+import json
+import shutil
 import subprocess
 import sys
 import os
@@ -311,11 +323,249 @@ def run_benchmark(dictionary: str, start_word: str, runs: int = 5):
     return 0
 
 
+# =============================================================================
+# Suite mode: size sweep, memory, hardware counters, JSON, regression gate
+# =============================================================================
+
+DEFAULT_SIZES = [10_000, 100_000, 1_000_000]
+DEFAULT_BASELINE = "benchmark_baseline.json"
+
+# Rough words-per-chain-group yield of generate_stress_dict.py (chain plus
+# branches plus the 50% random filler), used to aim at a target size
+WORDS_PER_GROUP = 55
+
+
+def generate_suite_dictionary(size: int) -> tuple[Path, str]:
+    """Generate (or reuse) a deterministic dictionary of roughly `size` words.
+
+    Returns the dictionary path and a start word (shortest word in it).
+    """
+    import random
+
+    path = Path(f"build/bench_dict_{size}.txt")
+    if not path.exists():
+        sys.path.insert(0, str(Path("tests/data")))
+        import generate_stress_dict
+
+        print(f"Generating {size}-word dictionary: {path}")
+        random.seed(size)  # Same sizes regenerate the same dictionary
+        chain_count = max(3, size // WORDS_PER_GROUP)
+        words = generate_stress_dict.generate_stress_dictionary(
+            chain_count=chain_count, max_chain_length=12
+        )
+        path.parent.mkdir(exist_ok=True)
+        with open(path, "w") as f:
+            for word in sorted(words):
+                f.write(word + "\n")
+
+    with open(path) as f:
+        words = [line.strip() for line in f if line.strip()]
+    start_word = min(words, key=len)
+    return path, start_word
+
+
+def run_measured(cmd: list[str], timeout: int = 600):
+    """Run a command, returning (exit code, output, wall ms, max RSS KB).
+
+    Uses os.wait4() so the peak RSS is attributed to this child alone.
+    """
+    import threading
+
+    start = time.perf_counter()
+    proc = subprocess.Popen(
+        cmd, stdout=subprocess.PIPE, stderr=subprocess.STDOUT, text=True
+    )
+    # communicate() would reap the child before wait4() can see it, so
+    # read the pipe directly and guard against hangs with a kill timer
+    timer = threading.Timer(timeout, proc.kill)
+    timer.start()
+    try:
+        output = proc.stdout.read()
+    finally:
+        timer.cancel()
+    elapsed = (time.perf_counter() - start) * 1000.0
+    _, status, rusage = os.wait4(proc.pid, 0)
+    code = os.waitstatus_to_exitcode(status)
+    return code, output, elapsed, rusage.ru_maxrss
+
+
+def run_perf_stat(cmd: list[str]) -> dict | None:
+    """Collect cache misses and IPC with perf stat, or None if unavailable."""
+    if shutil.which("perf") is None:
+        return None
+
+    result = subprocess.run(
+        ["perf", "stat", "-x,", "-e", "cache-misses,cycles,instructions"]
+        + cmd,
+        capture_output=True,
+        text=True,
+    )
+    if result.returncode != 0:
+        return None
+
+    counters = {}
+    for line in result.stderr.splitlines():
+        fields = line.split(",")
+        if len(fields) >= 3 and fields[0].replace(".", "").isdigit():
+            counters[fields[2]] = float(fields[0])
+
+    if not counters:
+        return None
+
+    stats = {"cache_misses": counters.get("cache-misses")}
+    cycles = counters.get("cycles")
+    instructions = counters.get("instructions")
+    if cycles and instructions:
+        stats["ipc"] = instructions / cycles
+    return stats
+
+
+def run_suite(args) -> int:
+    """Sweep dictionary sizes over all implementations, emit JSON, and
+    gate against the stored baseline."""
+    sizes = [int(s) for s in args.sizes.split(",")]
+
+    print("=" * 80)
+    print("ANAGRAM CHAIN BENCHMARK SUITE")
+    print("=" * 80)
+    print(f"Sizes: {sizes}")
+    print(f"Runs per point: {args.runs}")
+    print()
+
+    subprocess.run(["make", "clean"], capture_output=True)
+    built = {}
+    for impl_config in IMPLEMENTATIONS:
+        built[impl_config["name"]] = build_implementation(impl_config)
+    if not all(built.values()):
+        print("ERROR: Not all implementations built")
+        return 1
+    print()
+
+    results = []
+    for size in sizes:
+        dictionary, start_word = generate_suite_dictionary(size)
+        word_count = sum(1 for _ in open(dictionary))
+        print("-" * 80)
+        print(f"SIZE {size} ({word_count} words, start '{start_word}')")
+        print("-" * 80)
+
+        for impl_config in IMPLEMENTATIONS:
+            name = impl_config["name"]
+            binary = Path(f"bin/anagram_chain_{name}")
+            cmd = [str(binary), str(dictionary), start_word]
+
+            times = []
+            max_rss_kb = 0
+            last_output = ""
+            for _ in range(args.runs):
+                code, output, elapsed, rss = run_measured(cmd)
+                if code != 0:
+                    print(f"  {name}: ERROR (exit code {code})")
+                    break
+                times.append(elapsed)
+                max_rss_kb = max(max_rss_kb, rss)
+                last_output = output
+            if not times:
+                continue
+
+            chain_count, chain_length = parse_result(last_output)
+            entry = {
+                "impl": name,
+                "size": size,
+                "words": word_count,
+                "wall_ms_min": min(times),
+                "wall_ms_avg": statistics.mean(times),
+                "max_rss_kb": max_rss_kb,
+                "chain_count": chain_count,
+                "chain_length": chain_length,
+                "perf": run_perf_stat(cmd),
+                "internal_timings": parse_timing(last_output),
+            }
+            results.append(entry)
+            perf_note = ""
+            if entry["perf"] and entry["perf"].get("ipc"):
+                perf_note = f"  ipc={entry['perf']['ipc']:.2f}"
+            print(
+                f"  {name:<14} {entry['wall_ms_min']:>10.2f} ms"
+                f"  rss={max_rss_kb} KB"
+                f"  len={chain_length} x{chain_count}{perf_note}"
+            )
+        print()
+
+    report = {
+        "timestamp": time.strftime("%Y-%m-%dT%H:%M:%S"),
+        "runs": args.runs,
+        "sizes": sizes,
+        "results": results,
+    }
+
+    if args.json:
+        with open(args.json, "w") as f:
+            json.dump(report, f, indent=2)
+        print(f"Wrote {args.json}")
+
+    baseline_path = Path(args.baseline)
+    if args.update_baseline:
+        with open(baseline_path, "w") as f:
+            json.dump(report, f, indent=2)
+        print(f"Baseline updated: {baseline_path}")
+        return 0
+
+    if not baseline_path.exists():
+        print(f"No baseline at {baseline_path} (create with --update-baseline)")
+        return 0
+
+    with open(baseline_path) as f:
+        baseline = json.load(f)
+    base_index = {(r["impl"], r["size"]): r for r in baseline["results"]}
+
+    regressions = []
+    for entry in results:
+        base = base_index.get((entry["impl"], entry["size"]))
+        if base is None:
+            continue
+        for metric in ("wall_ms_min", "max_rss_kb"):
+            old = base[metric]
+            new = entry[metric]
+            if old > 0 and new > old * (1.0 + args.threshold):
+                regressions.append(
+                    f"{entry['impl']} @ {entry['size']}: {metric} "
+                    f"{old:.2f} -> {new:.2f} (+{(new / old - 1) * 100:.1f}%)"
+                )
+
+    if regressions:
+        print("\nREGRESSIONS (threshold {:.0%}):".format(args.threshold))
+        for r in regressions:
+            print(f"  {r}")
+        return 1
+
+    print(f"\nNo regressions against {baseline_path}")
+    return 0
+
+
+def suite_main() -> int:
+    parser = argparse.ArgumentParser(description="Benchmark suite mode")
+    parser.add_argument("--suite", action="store_true")
+    parser.add_argument("--sizes", default=",".join(str(s) for s in DEFAULT_SIZES))
+    parser.add_argument("--runs", type=int, default=3)
+    parser.add_argument("--json", default=None, help="Write results JSON here")
+    parser.add_argument("--baseline", default=DEFAULT_BASELINE)
+    parser.add_argument("--threshold", type=float, default=0.15)
+    parser.add_argument(
+        "--update-baseline", action="store_true",
+        help="Store these results as the new baseline and exit"
+    )
+    return run_suite(parser.parse_args())
+
+
 def main():
     # Default values
     dictionary = "tests/data/stress.txt"
     start_word = None
     runs = 5
+
+    if "--suite" in sys.argv:
+        return suite_main()
     
     # Parse arguments
     if len(sys.argv) > 1:
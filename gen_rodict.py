@@ -0,0 +1,162 @@
+#!/usr/bin/env python3
+"""Generate a flash-resident dictionary + index for the ARM targets.
+
+Reads a word list (one word per line) and emits a C file with the
+words, their precomputed signatures and a collision-free sorted-array
+index, all const so they land in .rodata/flash. Built against
+ARM_RODICT (see src/impl/human/rodict.h), the firmware boots straight
+to query-ready: no per-word signature computation, no
+hashtable_insert() pass, and no SRAM spent on the word or hash entry
+pools.
+
+Usage: gen_rodict.py WORDLIST -o OUTPUT.c
+"""
+
+import argparse
+import sys
+
+ASCII_MIN = 33
+ASCII_MAX = 126
+
+# Bitmap sizing: ~8 bits per unique signature keeps the false-positive
+# rate of the pre-search filter in the percent range
+BITS_PER_ENTRY = 8
+
+
+def fnv1a32(s):
+    """32-bit FNV-1a; must match rodict_hash32() in the C code."""
+    h = 2166136261
+    for b in s.encode("ascii"):
+        h ^= b
+        h = (h * 16777619) & 0xFFFFFFFF
+    return h
+
+
+def c_str(s):
+    """Quote a word for a C string literal (printable ASCII only)."""
+    return '"' + s.replace("\\", "\\\\").replace('"', '\\"') + '"'
+
+
+def load_words(path):
+    words = []
+    seen = set()
+    with open(path, "r", encoding="ascii", errors="strict") as f:
+        for lineno, line in enumerate(f, 1):
+            word = line.strip()
+            if not word:
+                continue
+            if any(ord(c) < ASCII_MIN or ord(c) > ASCII_MAX for c in word):
+                print(f"{path}:{lineno}: skipping non-printable word",
+                      file=sys.stderr)
+                continue
+            if word in seen:
+                print(f"{path}:{lineno}: skipping duplicate '{word}'",
+                      file=sys.stderr)
+                continue
+            seen.add(word)
+            words.append(word)
+    return words
+
+
+def emit(words, src_name, out):
+    sigs = ["".join(sorted(w)) for w in words]
+
+    # Unique signatures sorted by byte order (== strcmp order for ASCII),
+    # each with its run of word indices
+    by_sig = {}
+    for i, sig in enumerate(sigs):
+        by_sig.setdefault(sig, []).append(i)
+    sorted_sigs = sorted(by_sig)
+
+    indices = []
+    entries = []
+    for sig in sorted_sigs:
+        run = by_sig[sig]
+        entries.append((sig, len(indices), len(run)))
+        indices.extend(run)
+
+    # Word indices sorted by word byte order, for start-word lookup
+    word_order = sorted(range(len(words)), key=lambda i: words[i])
+
+    # Signature occupancy bitmap
+    bits_words = max(2, (len(entries) * BITS_PER_ENTRY + 31) // 32)
+    bitmap = [0] * bits_words
+    for sig in sorted_sigs:
+        bit = fnv1a32(sig) % (bits_words * 32)
+        bitmap[bit // 32] |= 1 << (bit % 32)
+
+    max_sig_len = max((len(s) for s in sigs), default=0)
+    len_counts = [0] * (max_sig_len + 1)
+    for sig in sigs:
+        len_counts[len(sig)] += 1
+
+    w = out.write
+    w(f"/* Generated by gen_rodict.py from {src_name} - do not edit */\n\n")
+    w('#include "rodict.h"\n\n')
+
+    w("const char *const g_rodict_words[] = {\n")
+    for word in words:
+        w(f"    {c_str(word)},\n")
+    w("};\n\n")
+
+    w("const char *const g_rodict_sigs[] = {\n")
+    for sig in sigs:
+        w(f"    {c_str(sig)},\n")
+    w("};\n\n")
+
+    w(f"const size_t g_rodict_word_count = {len(words)};\n\n")
+
+    w("const size_t g_rodict_indices[] = {\n")
+    for i in range(0, len(indices), 12):
+        w("    " + ", ".join(str(x) for x in indices[i:i + 12]) + ",\n")
+    w("};\n\n")
+
+    w("const RoDictEntry g_rodict_entries[] = {\n")
+    for sig, off, cnt in entries:
+        w(f"    {{{c_str(sig)}, {off}, {cnt}}},\n")
+    w("};\n\n")
+
+    w(f"const size_t g_rodict_entry_count = {len(entries)};\n\n")
+
+    w("const uint32_t g_rodict_word_order[] = {\n")
+    for i in range(0, len(word_order), 12):
+        w("    " + ", ".join(str(x) for x in word_order[i:i + 12]) + ",\n")
+    w("};\n\n")
+
+    w("const uint32_t g_rodict_sig_bits[] = {\n")
+    for i in range(0, bits_words, 6):
+        w("    " + ", ".join(f"0x{x:08x}u" for x in bitmap[i:i + 6]) + ",\n")
+    w("};\n\n")
+
+    w(f"const size_t g_rodict_sig_bits_words = {bits_words};\n\n")
+
+    w("const size_t g_rodict_len_counts[] = {\n")
+    for i in range(0, len(len_counts), 12):
+        w("    " + ", ".join(str(x) for x in len_counts[i:i + 12]) + ",\n")
+    w("};\n\n")
+
+    w(f"const size_t g_rodict_max_sig_len = {max_sig_len};\n")
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__)
+    ap.add_argument("wordlist", help="input word list, one word per line")
+    ap.add_argument("-o", "--output", required=True, help="output C file")
+    args = ap.parse_args()
+
+    words = load_words(args.wordlist)
+    if not words:
+        print(f"{args.wordlist}: no usable words", file=sys.stderr)
+        return 1
+
+    with open(args.output, "w", encoding="ascii") as out:
+        emit(words, args.wordlist, out)
+
+    print(f"{args.output}: {len(words)} words, "
+          f"{len(set(''.join(sorted(w)) for w in words))} unique signatures",
+          file=sys.stderr)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
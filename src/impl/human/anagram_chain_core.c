@@ -29,10 +29,89 @@ __attribute__((weak)) void trace_update_time(void)
 }
 #endif
 
+/* Binary trace ring - see trace.h. Total count keeps growing so the
+ * drain can tell how many records the wrap discarded. */
+static TraceRecord g_trace_ring[TRACE_RING_RECORDS];
+static unsigned int g_trace_ring_count;
+
+void trace_ring_log(uint16_t id, uint16_t line, uint32_t arg)
+{
+    TraceRecord *r;
+
+    r = &g_trace_ring[g_trace_ring_count % TRACE_RING_RECORDS];
+    r->id = id;
+    r->line = line;
+#if defined(PLATFORM_ARM)
+    trace_update_time();
+    r->tick = g_trace_tick_us;
+#else
+    r->tick = (uint32_t)(timer_now() * 1000.0);
+#endif
+    r->arg = arg;
+    g_trace_ring_count++;
+}
+
+void trace_ring_drain(void)
+{
+    unsigned int start;
+    unsigned int i;
+    const TraceRecord *r;
+
+    if (g_trace_ring_count == 0)
+    {
+        return;
+    }
+
+    start = 0;
+    if (g_trace_ring_count > TRACE_RING_RECORDS)
+    {
+        start = g_trace_ring_count - TRACE_RING_RECORDS;
+        OUTPUT("[trace] %u records dropped by ring wrap\n", (unsigned)start);
+    }
+
+    for (i = start; i < g_trace_ring_count; i++)
+    {
+        r = &g_trace_ring[i % TRACE_RING_RECORDS];
+        OUTPUT("[trace %u.%03u] id=%u line=%u arg=%u\n", r->tick / 1000,
+               r->tick % 1000, (unsigned)r->id, (unsigned)r->line,
+               (unsigned)r->arg);
+    }
+
+    g_trace_ring_count = 0;
+}
+
+/* Hot-path performance counters (see perf_stats.h); the pool fields are
+ * sampled by the per-mode perf_stats_get() below */
+PerfStats g_perf_stats;
+
+void perf_stats_reset(void)
+{
+    memset(&g_perf_stats, 0, sizeof(g_perf_stats));
+}
+
+void perf_stats_print(void)
+{
+    PerfStats s;
+
+    perf_stats_get(&s);
+
+    OUTPUT("\nPerf counters:\n");
+    OUTPUT("  dfs nodes:    %lu\n", s.dfs_nodes);
+    OUTPUT("  probe hits:   %lu\n", s.probe_hits);
+    OUTPUT("  probe misses: %lu\n", s.probe_misses);
+    OUTPUT("  ht inserts:   %lu\n", s.ht_inserts);
+    OUTPUT("  ht finds:     %lu (%lu probe steps)\n", s.ht_finds, s.ht_steps);
+    OUTPUT("  pool bytes:   words=%u sigs=%u\n",
+           (unsigned)s.pool_word_bytes, (unsigned)s.pool_sig_bytes);
+}
+
 /*
  * Helper functions
  */
 
+#if !defined(ARM_RODICT)
+/* Unused under ARM_RODICT: the generated tables carry their own
+ * fixed-width hash (see rodict_hash32() below) */
 static unsigned long hash_fnv1a(const char *s)
 {
     unsigned long h;
@@ -49,30 +128,56 @@ static unsigned long hash_fnv1a(const char *s)
 
     return h;
 }
+#endif
 
-/* Counting sort for signature - O(n) instead of qsort's O(n log n) */
+/* Shared histogram for sort_chars(): starts zeroed (BSS) and every call
+ * clears the slots it touched, so it is all-zero between calls. Words are
+ * typically much shorter than the histogram, so zeroing and rescanning
+ * all CHAR_COUNT_SIZE slots per word - a million times during bulk
+ * loading - cost more than the sort itself. */
+static int sig_counts[CHAR_COUNT_SIZE];
+
+/* Counting sort for signature - O(n) instead of qsort's O(n log n).
+ * Only the characters actually present are counted, emitted and cleared;
+ * their sorted order comes from a tiny insertion sort over the distinct
+ * characters (a handful for real words). */
 static void sort_chars(char *s, size_t len)
 {
-    int counts[CHAR_COUNT_SIZE] = {0};
+    unsigned char distinct[CHAR_COUNT_SIZE];
+    size_t nd = 0;
     size_t i;
+    size_t j;
     size_t pos;
-    int c;
+    unsigned char c;
 
     ASSERT_NOT_NULL(s);
 
     for (i = 0; i < len; i++)
     {
-        ASSERT_MSG((unsigned char)s[i] < CHAR_COUNT_SIZE, "char out of range");
-        counts[(unsigned char)s[i]]++;
+        c = (unsigned char)s[i];
+        ASSERT_MSG(c < CHAR_COUNT_SIZE, "char out of range");
+        if (sig_counts[c]++ == 0)
+        {
+            /* First occurrence - insert into the sorted distinct list */
+            j = nd++;
+            while (j > 0 && distinct[j - 1] > c)
+            {
+                distinct[j] = distinct[j - 1];
+                j--;
+            }
+            distinct[j] = c;
+        }
     }
 
     pos = 0;
-    for (c = 0; c < CHAR_COUNT_SIZE; c++)
+    for (j = 0; j < nd; j++)
     {
-        while (counts[c]-- > 0)
+        c = distinct[j];
+        for (i = 0; i < (size_t)sig_counts[c]; i++)
         {
             s[pos++] = (char)c;
         }
+        sig_counts[c] = 0;
     }
 }
 
@@ -108,12 +213,74 @@ static size_t insert_sorted(char *dst, const char *src, size_t len, char c)
     return j;
 }
 
+/* Worker count for the parallel chain search. Only the dynamic PC build
+ * spawns threads; other builds accept the setting and ignore it. */
+static int g_search_threads = SEARCH_DEFAULT_THREADS;
+
+void search_set_threads(int n)
+{
+    if (n < 1)
+    {
+        n = 1;
+    }
+    if (n > SEARCH_MAX_THREADS)
+    {
+        n = SEARCH_MAX_THREADS;
+    }
+    g_search_threads = n;
+}
+
 #if defined(USE_DYNAMIC_MEMORY)
 /*
  * Uses bulk allocation: one malloc for all words, one for all signatures.
  * This reduces malloc calls from O(2N) to O(1) and improves cache locality.
  */
 
+/* Open-addressed probe table keyed by count-vector signatures. Built once
+ * per index; the DFS derives candidates with a byte increment and rejects
+ * mismatches with an integer hash compare plus fixed-length memcmp. */
+typedef struct
+{
+    unsigned long hash; /* Full vector hash, checked before memcmp */
+    HashEntry *entry;   /* NULL = empty slot */
+    uint32_t id;        /* Dense entry id assigned at build time */
+    SigVec vec;
+} VecSlot;
+
+typedef struct
+{
+    VecSlot *slots;
+    size_t slot_count;   /* Power of two, 0 = not built */
+    HashEntry **entries; /* Entry lookup by dense id */
+    size_t entry_count;
+} VecIndex;
+
+/* Flat CSR successor graph over unique signatures: for each entry id, the
+ * ids of all signatures derivable by adding one character. Replaces the
+ * up-to-94 hash probes per DFS node with one contiguous adjacency walk. */
+typedef struct
+{
+    uint32_t *offsets;       /* entry_count + 1 offsets into targets */
+    uint32_t *targets;       /* Successor entry ids */
+    uint32_t *word_entry_id; /* Word index -> entry id */
+    size_t word_count;
+
+    /* Memo table: longest chain (in words) achievable from each unique
+     * signature, 0 = not yet computed. Lazily filled, shared across
+     * starts, so every subtree is explored exactly once. */
+    uint32_t *memo_longest;
+} AdjGraph;
+
+/* Word-keyed lookup index for find_word_index(): open addressing with
+ * cached word hashes, slot stores word index + 1 (0 = empty) */
+typedef struct
+{
+    unsigned long *hashes;
+    uint32_t *slots;
+    size_t slot_count; /* Power of two, 0 = not built */
+    size_t indexed;    /* dict->count when built; later adds scan the tail */
+} WordIndex;
+
 typedef struct
 {
     /* Bulk memory pools for words and signatures */
@@ -123,6 +290,35 @@ typedef struct
     HashTable *ht;
     ChainResults *results;
 
+    /* Cached full hashes for the open-addressed signature table: one slot
+     * per bucket, so most probe mismatches are rejected by an integer
+     * compare without dereferencing the entry or touching the string */
+    unsigned long *ht_hashes;
+
+    /* One occupancy bit per slot: at 1/64th the size of the pointer
+     * array it stays cache resident, so the common case - a candidate
+     * signature that does not exist - is rejected with one bit test
+     * before any probe touches the table itself */
+    unsigned long *ht_occupied;
+
+    VecIndex vec_index;
+    AdjGraph adj;
+    WordIndex word_index;
+
+    /* Set by build_index() and snapshot load: dictionary_add() then
+     * maintains the signature table incrementally. derived_stale flags
+     * that an add introduced a new signature, whose graph node the flat
+     * CSR cannot take in place - the derived structures are rebuilt once
+     * on the next search instead of on every add. */
+    int index_built;
+    int derived_stale;
+
+    /* Words per signature length, filled by build_index(): a zero count
+     * for length k+1 ends every chain from a length-k node without a
+     * single probe, and max_sig_len bounds the remaining depth */
+    size_t len_counts[POOL_MAX_WORD_LEN + 1];
+    size_t max_sig_len; /* Longest populated length, 0 = not counted */
+
     DfsContext dfs;
     size_t *dfs_path_dynamic;
 } GlobalState;
@@ -130,704 +326,2772 @@ typedef struct
 static GlobalState G = {0};
 #define GLOBAL G
 
-/* DFS search - no visited array needed, chains always grow in length */
-static void dfs_dynamic(HashTable *ht, Dictionary *dict, size_t cur,
-                        size_t depth)
+/* Build count vector from a signature (or any word - order is irrelevant) */
+static void sigvec_from_sig(const char *sig, SigVec vec)
 {
-    const char *sig;
-    size_t sig_len;
-    int found;
-    int c;
-    HashEntry *entry;
+    ASSERT_NOT_NULL(sig);
+
+    memset(vec, 0, SIG_VEC_SIZE);
+
+    while (*sig)
+    {
+        ASSERT_MSG((unsigned char)*sig >= ASCII_MIN &&
+                       (unsigned char)*sig <= ASCII_MAX,
+                   "char out of range");
+        vec[(unsigned char)*sig++ - ASCII_MIN]++;
+    }
+}
+
+/*
+ * Multiset hash over count vectors: h = sum(count[i] * mix[i]).
+ * Commutative and linear, so adding one character to a candidate updates
+ * the hash with a single addition instead of rehashing 94 bytes - the
+ * probing loops lean on this heavily.
+ */
+static unsigned long g_vec_mix[SIG_VEC_SIZE];
+static int g_vec_mix_init = 0;
+
+/* Fill the per-character mix constants (splitmix64, fixed seed) */
+static void vec_hash_init(void)
+{
+    uint64_t state = 0x243f6a8885a308d3ull;
+    uint64_t z;
     size_t i;
-    size_t next;
-    size_t new_cap;
-    Chain *new_chains;
-    size_t *indices;
 
-    ASSERT_NOT_NULL(ht);
-    ASSERT_NOT_NULL(dict);
-    ASSERT_MSG(cur < dict->count, "cur index out of bounds");
-    ASSERT_MSG(depth <= MAX_CHAIN_DEPTH, "depth exceeds MAX_CHAIN_DEPTH");
+    for (i = 0; i < SIG_VEC_SIZE; i++)
+    {
+        state += 0x9e3779b97f4a7c15ull;
+        z = state;
+        z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+        z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+        g_vec_mix[i] = (unsigned long)(z ^ (z >> 31));
+    }
 
-    sig = dict->signatures[cur];
-    ASSERT_NOT_NULL(sig);
-    sig_len = strlen(sig);
-    found = 0;
+    g_vec_mix_init = 1;
+}
 
-    if (depth >= MAX_CHAIN_DEPTH)
+static unsigned long hash_vec(const SigVec vec)
+{
+    unsigned long h;
+    size_t i;
+
+    h = 0;
+
+    for (i = 0; i < SIG_VEC_SIZE; i++)
     {
-        return;
+        h += (unsigned long)vec[i] * g_vec_mix[i];
     }
 
-    /* Try adding each printable ASCII character */
-    for (c = ASCII_MIN; c <= ASCII_MAX; c++)
+    return h;
+}
+
+static void vec_index_free(void)
+{
+    free(GLOBAL.vec_index.slots);
+    free(GLOBAL.vec_index.entries);
+    GLOBAL.vec_index.slots = NULL;
+    GLOBAL.vec_index.slot_count = 0;
+    GLOBAL.vec_index.entries = NULL;
+    GLOBAL.vec_index.entry_count = 0;
+}
+
+static void adj_graph_free(void)
+{
+    free(GLOBAL.adj.offsets);
+    free(GLOBAL.adj.targets);
+    free(GLOBAL.adj.word_entry_id);
+    free(GLOBAL.adj.memo_longest);
+    GLOBAL.adj.offsets = NULL;
+    GLOBAL.adj.targets = NULL;
+    GLOBAL.adj.word_entry_id = NULL;
+    GLOBAL.adj.memo_longest = NULL;
+    GLOBAL.adj.word_count = 0;
+}
+
+/* Build the count-vector probe table over all unique signatures */
+static int vec_index_build(HashTable *ht)
+{
+    size_t cap;
+    size_t b;
+    size_t slot;
+    HashEntry *entry;
+    SigVec vec;
+    unsigned long hash;
+
+    TRACE(">> vec_index_build entries=%u", (unsigned)ht->entry_count);
+
+    vec_index_free();
+
+    if (!g_vec_mix_init)
     {
-        insert_sorted(GLOBAL.dfs.candidate, sig, sig_len, (char)c);
+        vec_hash_init();
+    }
 
-        entry = hashtable_find(ht, GLOBAL.dfs.candidate);
-        if (entry)
-        {
-            for (i = 0; i < entry->word_count; i++)
-            {
-                next = entry->word_indices[i];
-                found = 1;
-                GLOBAL.dfs_path_dynamic[depth] = next;
-                dfs_dynamic(ht, dict, next, depth + 1);
-            }
-        }
+    /* Power of two, at most 50% load factor */
+    cap = 16;
+    while (cap < ht->entry_count * 2)
+    {
+        cap *= 2;
     }
 
-    /* Leaf node - save chain if it's the longest found so far */
-    if (!found && GLOBAL.results)
+    GLOBAL.vec_index.slots = calloc(cap, sizeof(VecSlot));
+    GLOBAL.vec_index.entries = malloc(ht->entry_count * sizeof(HashEntry *));
+    if (!GLOBAL.vec_index.slots || !GLOBAL.vec_index.entries)
     {
-        if (depth > GLOBAL.results->max_length)
-        {
-            /* New longest chain - clear previous results */
-            for (i = 0; i < GLOBAL.results->count; i++)
-            {
-                free(GLOBAL.results->chains[i].indices);
-            }
-            GLOBAL.results->count = 0;
-            GLOBAL.results->max_length = depth;
-        }
+        vec_index_free();
+        TRACE("<< vec_index_build (alloc failed)");
+        return -1;
+    }
+    GLOBAL.vec_index.slot_count = cap;
 
-        if (depth == GLOBAL.results->max_length &&
-            GLOBAL.results->count < MAX_CHAINS)
+    for (b = 0; b < ht->bucket_count; b++)
+    {
+        for (entry = ht->buckets[b]; entry; entry = entry->next)
         {
-            /* Grow chains array if needed */
-            if (GLOBAL.results->count >= GLOBAL.results->capacity)
-            {
-                new_cap = GLOBAL.results->capacity * 2;
-                new_chains =
-                    realloc(GLOBAL.results->chains, new_cap * sizeof(Chain));
-                if (!new_chains)
-                {
-                    return;
-                }
-                GLOBAL.results->chains = new_chains;
-                GLOBAL.results->capacity = new_cap;
-            }
+            sigvec_from_sig(entry->signature, vec);
+            hash = hash_vec(vec);
 
-            /* Store this chain */
-            indices = malloc(depth * sizeof(size_t));
-            if (!indices)
+            slot = hash & (cap - 1);
+            while (GLOBAL.vec_index.slots[slot].entry)
             {
-                return;
+                slot = (slot + 1) & (cap - 1);
             }
-            memcpy(indices, GLOBAL.dfs_path_dynamic, depth * sizeof(size_t));
-            GLOBAL.results->chains[GLOBAL.results->count].indices = indices;
-            GLOBAL.results->chains[GLOBAL.results->count].length = depth;
-            GLOBAL.results->count++;
+
+            GLOBAL.vec_index.slots[slot].hash = hash;
+            GLOBAL.vec_index.slots[slot].entry = entry;
+            GLOBAL.vec_index.slots[slot].id =
+                (uint32_t)GLOBAL.vec_index.entry_count;
+            memcpy(GLOBAL.vec_index.slots[slot].vec, vec, SIG_VEC_SIZE);
+
+            GLOBAL.vec_index.entries[GLOBAL.vec_index.entry_count++] = entry;
         }
     }
+
+    TRACE("<< vec_index_build slots=%u entries=%u", (unsigned)cap,
+          (unsigned)GLOBAL.vec_index.entry_count);
+
+    return 0;
 }
 
-Dictionary *dictionary_create(size_t cap)
+/* Caller supplies the hash: probing loops maintain it incrementally */
+static HashEntry *vec_index_find(const SigVec vec, unsigned long hash)
 {
-    Dictionary *dict = NULL;
-    size_t pool_size;
-    int success = 0;
+    size_t slot;
+    size_t mask;
+    const VecSlot *s;
 
-    TRACE(">> dictionary_create cap=%u", (unsigned)cap);
+    mask = GLOBAL.vec_index.slot_count - 1;
+    slot = hash & mask;
 
-    do
+    while ((s = &GLOBAL.vec_index.slots[slot])->entry)
     {
-        dict = malloc(sizeof(Dictionary));
-        if (!dict)
+        if (s->hash == hash && memcmp(s->vec, vec, SIG_VEC_SIZE) == 0)
         {
-            break;
+            return s->entry;
         }
+        slot = (slot + 1) & mask;
+    }
 
-        dict->words = malloc(cap * sizeof(char *));
-        dict->signatures = malloc(cap * sizeof(char *));
-        if (!dict->words || !dict->signatures)
-        {
-            break;
-        }
+    return NULL;
+}
 
-        /* Pre-allocate bulk pools - estimate 12 bytes per word average */
-        pool_size = cap * 24;
-        GLOBAL.pools.word_pool = malloc(pool_size);
-        GLOBAL.pools.sig_pool = malloc(pool_size);
-        if (!GLOBAL.pools.word_pool || !GLOBAL.pools.sig_pool)
+/* Like vec_index_find but returns the dense entry id, or -1 on miss */
+static long vec_index_find_id(const SigVec vec, unsigned long hash)
+{
+    size_t slot;
+    size_t mask;
+    const VecSlot *s;
+
+    mask = GLOBAL.vec_index.slot_count - 1;
+    slot = hash & mask;
+
+    while ((s = &GLOBAL.vec_index.slots[slot])->entry)
+    {
+        if (s->hash == hash && memcmp(s->vec, vec, SIG_VEC_SIZE) == 0)
         {
-            break;
+            return (long)s->id;
         }
+        slot = (slot + 1) & mask;
+    }
 
-        GLOBAL.pools.pool_size = pool_size;
-        GLOBAL.pools.word_used = 0;
-        GLOBAL.pools.sig_used = 0;
+    return -1;
+}
 
-        dict->count = 0;
-        dict->capacity = cap;
-        GLOBAL.dict = dict;
+/* Materialize the successor graph: one probing pass per unique signature,
+ * results stored in a compact CSR layout the DFS can walk without hashing */
+static int adj_graph_build(Dictionary *dict)
+{
+    size_t num;
+    size_t e;
+    size_t i;
+    size_t used;
+    size_t cap;
+    int c;
+    long id;
+    SigVec vec;
+    unsigned long base_hash;
+    HashEntry *entry;
+    uint32_t *new_targets;
 
-        success = 1;
-    } while (0);
+    num = GLOBAL.vec_index.entry_count;
 
-    if (!success)
+    TRACE(">> adj_graph_build entries=%u", (unsigned)num);
+
+    adj_graph_free();
+
+    if (!num)
     {
-        if (dict)
+        TRACE("<< adj_graph_build (no entries)");
+        return -1;
+    }
+
+    cap = num * 4;
+    GLOBAL.adj.offsets = malloc((num + 1) * sizeof(uint32_t));
+    GLOBAL.adj.targets = malloc(cap * sizeof(uint32_t));
+    GLOBAL.adj.word_entry_id = malloc(dict->count * sizeof(uint32_t));
+    GLOBAL.adj.memo_longest = calloc(num, sizeof(uint32_t));
+    if (!GLOBAL.adj.offsets || !GLOBAL.adj.targets ||
+        !GLOBAL.adj.word_entry_id || !GLOBAL.adj.memo_longest)
+    {
+        adj_graph_free();
+        TRACE("<< adj_graph_build (alloc failed)");
+        return -1;
+    }
+
+    used = 0;
+    for (e = 0; e < num; e++)
+    {
+        GLOBAL.adj.offsets[e] = (uint32_t)used;
+
+        entry = GLOBAL.vec_index.entries[e];
+        sigvec_from_sig(entry->signature, vec);
+        base_hash = hash_vec(vec);
+
+        for (c = ASCII_MIN; c <= ASCII_MAX; c++)
         {
-            free(dict->words);
-            free(dict->signatures);
-            free(dict);
-        }
-        free(GLOBAL.pools.word_pool);
-        free(GLOBAL.pools.sig_pool);
-        GLOBAL.pools.word_pool = NULL;
-        GLOBAL.pools.sig_pool = NULL;
+            vec[c - ASCII_MIN]++;
+            id = vec_index_find_id(vec, base_hash + g_vec_mix[c - ASCII_MIN]);
+            vec[c - ASCII_MIN]--;
 
-        TRACE("<< dictionary_create (failed)");
+            if (id < 0)
+            {
+                continue;
+            }
 
-        return NULL;
+            if (used >= cap)
+            {
+                cap *= 2;
+                new_targets = realloc(GLOBAL.adj.targets,
+                                      cap * sizeof(uint32_t));
+                if (!new_targets)
+                {
+                    adj_graph_free();
+                    TRACE("<< adj_graph_build (realloc failed)");
+                    return -1;
+                }
+                GLOBAL.adj.targets = new_targets;
+            }
+            GLOBAL.adj.targets[used++] = (uint32_t)id;
+        }
+
+        /* Map this entry's words back to its id for DFS entry */
+        for (i = 0; i < entry->word_count; i++)
+        {
+            if (entry->word_indices[i] < dict->count)
+            {
+                GLOBAL.adj.word_entry_id[entry->word_indices[i]] =
+                    (uint32_t)e;
+            }
+        }
     }
+    GLOBAL.adj.offsets[num] = (uint32_t)used;
+    GLOBAL.adj.word_count = dict->count;
 
-    TRACE("<< dictionary_create");
+    TRACE("<< adj_graph_build edges=%u", (unsigned)used);
 
-    return dict;
+    return 0;
 }
 
-void dictionary_free(Dictionary *dict)
+static void word_index_free(void)
 {
-    TRACE(">> dictionary_free");
+    free(GLOBAL.word_index.hashes);
+    free(GLOBAL.word_index.slots);
+    memset(&GLOBAL.word_index, 0, sizeof(GLOBAL.word_index));
+}
 
-    if (!dict)
+/* Index every word by its own hash (not the signature's) so start-word
+ * resolution is a couple of probes instead of a dictionary sweep */
+static int word_index_build(Dictionary *dict)
+{
+    size_t slots;
+    size_t mask;
+    size_t i;
+    size_t j;
+    unsigned long h;
+
+    word_index_free();
+
+    slots = 16;
+    while (slots < dict->count * 2)
     {
-        TRACE("<< dictionary_free (NULL)");
-        return;
+        slots <<= 1;
     }
 
-    /* Single free for each pool instead of N frees */
-    free(GLOBAL.pools.word_pool);
-    free(GLOBAL.pools.sig_pool);
-    GLOBAL.pools.word_pool = NULL;
-    GLOBAL.pools.sig_pool = NULL;
-    GLOBAL.pools.pool_size = 0;
-    GLOBAL.pools.word_used = 0;
-    GLOBAL.pools.sig_used = 0;
-
-    free(dict->words);
-    free(dict->signatures);
-    free(dict);
-    GLOBAL.dict = NULL;
-
-    TRACE("<< dictionary_free");
-}
-
-int dictionary_add(Dictionary *dict, const char *word)
-{
-    size_t new_cap;
-    char **new_words;
-    char **new_sigs;
-    size_t len;
-    size_t needed;
-    size_t new_size;
-    uintptr_t old_word_base;
-    uintptr_t old_sig_base;
-    char *new_word_pool;
-    char *new_sig_pool;
-    ptrdiff_t word_delta;
-    ptrdiff_t sig_delta;
-    size_t i;
-    char *word_ptr;
-    char *sig_ptr;
-
-    TRACE(">> dictionary_add word=%s", word ? word : "NULL");
-
-    if (!dict || !word)
+    GLOBAL.word_index.hashes = malloc(slots * sizeof(unsigned long));
+    GLOBAL.word_index.slots = calloc(slots, sizeof(uint32_t));
+    if (!GLOBAL.word_index.hashes || !GLOBAL.word_index.slots)
     {
-        TRACE("<< dictionary_add (invalid args)");
+        word_index_free();
+        TRACE_ERR("word_index_build: out of memory");
         return -1;
     }
 
-    /* Grow pointer arrays if needed */
-    if (dict->count >= dict->capacity)
+    mask = slots - 1;
+    for (i = 0; i < dict->count; i++)
     {
-        new_cap = dict->capacity * 2;
-        new_words = realloc(dict->words, new_cap * sizeof(char *));
-        new_sigs = realloc(dict->signatures, new_cap * sizeof(char *));
-        if (!new_words || !new_sigs)
+        h = hash_fnv1a(dict->words[i]);
+        j = (size_t)h & mask;
+        while (GLOBAL.word_index.slots[j])
         {
-            TRACE("<< dictionary_add (realloc failed)");
-            return -1;
+            if (GLOBAL.word_index.hashes[j] == h &&
+                strcmp(dict->words[GLOBAL.word_index.slots[j] - 1],
+                       dict->words[i]) == 0)
+            {
+                /* Duplicate word - keep the first index, like the scan */
+                break;
+            }
+            j = (j + 1) & mask;
+        }
+        if (!GLOBAL.word_index.slots[j])
+        {
+            GLOBAL.word_index.slots[j] = (uint32_t)i + 1;
+            GLOBAL.word_index.hashes[j] = h;
         }
-        dict->words = new_words;
-        dict->signatures = new_sigs;
-        dict->capacity = new_cap;
     }
 
-    len = strlen(word);
-    needed = len + 1;
+    GLOBAL.word_index.slot_count = slots;
+    GLOBAL.word_index.indexed = dict->count;
 
-    /* Grow pools if needed */
-    if (GLOBAL.pools.word_used + needed > GLOBAL.pools.pool_size ||
-        GLOBAL.pools.sig_used + needed > GLOBAL.pools.pool_size)
-    {
-        new_size = GLOBAL.pools.pool_size * 2;
+    return 0;
+}
 
-        /* Save old base addresses for pointer adjustment */
-        old_word_base = (uintptr_t)GLOBAL.pools.word_pool;
-        old_sig_base = (uintptr_t)GLOBAL.pools.sig_pool;
+/* Longest chain (in words, including this node) achievable from an entry.
+ * Memoized over the DAG: each unique signature's subtree is solved once,
+ * no matter how many words share it or how many paths reach it. */
+static uint32_t memo_longest_from(uint32_t eid)
+{
+    uint32_t best;
+    uint32_t len;
+    uint32_t k;
 
-        new_word_pool = realloc(GLOBAL.pools.word_pool, new_size);
-        new_sig_pool = realloc(GLOBAL.pools.sig_pool, new_size);
-        if (!new_word_pool || !new_sig_pool)
-        {
-            TRACE("<< dictionary_add (pool realloc failed)");
-            return -1;
-        }
+    if (GLOBAL.adj.memo_longest[eid])
+    {
+        return GLOBAL.adj.memo_longest[eid];
+    }
 
-        /* Adjust existing pointers to new pool locations */
-        word_delta = (uintptr_t)new_word_pool - old_word_base;
-        sig_delta = (uintptr_t)new_sig_pool - old_sig_base;
-        for (i = 0; i < dict->count; i++)
+    best = 0;
+    for (k = GLOBAL.adj.offsets[eid]; k < GLOBAL.adj.offsets[eid + 1]; k++)
+    {
+        len = memo_longest_from(GLOBAL.adj.targets[k]);
+        if (len > best)
         {
-            dict->words[i] += word_delta;
-            dict->signatures[i] += sig_delta;
+            best = len;
         }
-
-        GLOBAL.pools.word_pool = new_word_pool;
-        GLOBAL.pools.sig_pool = new_sig_pool;
-        GLOBAL.pools.pool_size = new_size;
     }
 
-    /* Store word in pool */
-    word_ptr = GLOBAL.pools.word_pool + GLOBAL.pools.word_used;
-    memcpy(word_ptr, word, len + 1);
-    GLOBAL.pools.word_used += len + 1;
-    dict->words[dict->count] = word_ptr;
-
-    /* Compute and store signature in pool */
-    sig_ptr = GLOBAL.pools.sig_pool + GLOBAL.pools.sig_used;
-    memcpy(sig_ptr, word, len + 1);
-    sort_chars(sig_ptr, len);
-    GLOBAL.pools.sig_used += len + 1;
-    dict->signatures[dict->count] = sig_ptr;
-
-    dict->count++;
-
-    TRACE("<< dictionary_add count=%u", (unsigned)dict->count);
+    GLOBAL.adj.memo_longest[eid] = best + 1;
 
-    return 0;
+    return best + 1;
 }
 
-HashTable *hashtable_create(size_t bucket_count)
+/* Reserve room for 'len' more indices in the result set's shared pool,
+ * rebasing the stored chain pointers if growing moves the pool. Returns
+ * the write position, or NULL on allocation failure. */
+static size_t *results_pool_reserve(ChainResults *res, size_t len)
 {
-    HashTable *ht = NULL;
-    int success = 0;
-
-    TRACE(">> hashtable_create");
+    size_t new_cap;
+    size_t *new_pool;
+    size_t off;
+    size_t i;
 
-    do
+    if (res->pool_used + len > res->pool_capacity)
     {
-        ht = malloc(sizeof(HashTable));
-        if (!ht)
+        new_cap = res->pool_capacity ? res->pool_capacity * 2 : 1024;
+        while (new_cap < res->pool_used + len)
         {
-            break;
+            new_cap *= 2;
         }
 
-        ht->buckets = calloc(bucket_count, sizeof(HashEntry *));
-        if (!ht->buckets)
+        new_pool = realloc(res->index_pool, new_cap * sizeof(size_t));
+        if (!new_pool)
         {
-            break;
+            return NULL;
         }
 
-        ht->bucket_count = bucket_count;
-        ht->entry_count = 0;
-        GLOBAL.ht = ht;
-
-        success = 1;
-    } while (0);
-
-    if (!success)
-    {
-        if (ht)
+        if (new_pool != res->index_pool)
         {
-            free(ht);
+            for (i = 0; i < res->count; i++)
+            {
+                off = (size_t)(res->chains[i].indices - res->index_pool);
+                res->chains[i].indices = new_pool + off;
+            }
         }
-
-        TRACE("<< hashtable_create (failed)");
-
-        return NULL;
+        res->index_pool = new_pool;
+        res->pool_capacity = new_cap;
     }
 
-    TRACE("<< hashtable_create");
-
-    return ht;
+    return res->index_pool + res->pool_used;
 }
 
-void hashtable_free(HashTable *ht)
+/* Append the first 'len' words of a path buffer to a result set. Takes the
+ * destination explicitly so parallel workers can fill private sets. */
+static void results_append_path(ChainResults *res, const size_t *path,
+                                size_t len)
 {
-    size_t i;
-    HashEntry *entry;
-    HashEntry *next;
-
-    TRACE(">> hashtable_free");
+    size_t new_cap;
+    Chain *new_chains;
+    size_t *indices;
 
-    if (!ht)
+    if (!res || res->count >= MAX_CHAINS)
     {
-        TRACE("<< hashtable_free (NULL)");
         return;
     }
 
-    for (i = 0; i < ht->bucket_count; i++)
+    if (res->count >= res->capacity)
     {
-        entry = ht->buckets[i];
-        while (entry)
+        new_cap = res->capacity * 2;
+        new_chains = realloc(res->chains, new_cap * sizeof(Chain));
+        if (!new_chains)
         {
-            next = entry->next;
-            /* signature points into sig_pool, don't free it */
-            free(entry->word_indices);
-            free(entry);
-            entry = next;
+            return;
         }
+        res->chains = new_chains;
+        res->capacity = new_cap;
     }
 
-    free(ht->buckets);
-    free(ht);
-    GLOBAL.ht = NULL;
-
-    TRACE("<< hashtable_free");
+    indices = results_pool_reserve(res, len);
+    if (!indices)
+    {
+        return;
+    }
+    memcpy(indices, path, len * sizeof(size_t));
+    res->chains[res->count].indices = indices;
+    res->chains[res->count].length = len;
+    res->pool_used += len;
+    res->count++;
 }
 
-void hashtable_insert(HashTable *ht, const char *sig, size_t word_idx)
+/* Enumerate longest chains only: with the memo table known, descend just
+ * into successors whose longest suffix exactly fills the remaining depth.
+ * Reentrant over (res, path) - the memo and graph are read-only here. */
+static void dfs_enum_optimal(ChainResults *res, size_t *path, uint32_t eid,
+                             size_t depth, size_t max_len)
 {
-    unsigned long hash;
+    uint32_t k;
+    uint32_t t;
     HashEntry *entry;
-    size_t new_cap;
-    size_t *new_idx;
+    size_t i;
 
-    TRACE(">> hashtable_insert sig=%s idx=%u", sig ? sig : "NULL",
-          (unsigned)word_idx);
+    PERF_COUNT(dfs_nodes);
 
-    if (!ht || !sig)
+    if (depth == max_len)
     {
-        TRACE("<< hashtable_insert (invalid args)");
+        results_append_path(res, path, depth);
         return;
     }
 
-    ASSERT_MSG(ht->bucket_count > 0, "bucket_count must be > 0");
-
-    hash = hash_fnv1a(sig) % ht->bucket_count;
-
-    /* Check if signature already exists in this bucket */
-    entry = ht->buckets[hash];
-    while (entry)
+    for (k = GLOBAL.adj.offsets[eid]; k < GLOBAL.adj.offsets[eid + 1]; k++)
     {
-        if (strcmp(entry->signature, sig) == 0)
+        t = GLOBAL.adj.targets[k];
+        if (GLOBAL.adj.memo_longest[t] != (uint32_t)(max_len - depth))
         {
-            /* Add word index to existing entry */
-            if (entry->word_count >= entry->word_capacity)
-            {
-                new_cap = entry->word_capacity * 2;
-                new_idx =
-                    realloc(entry->word_indices, new_cap * sizeof(size_t));
-                if (!new_idx)
-                {
-                    TRACE("<< hashtable_insert (realloc failed)");
-                    return;
-                }
-                entry->word_indices = new_idx;
-                entry->word_capacity = new_cap;
-            }
-            entry->word_indices[entry->word_count++] = word_idx;
-
-            TRACE("<< hashtable_insert (existing)");
+            continue;
+        }
 
-            return;
+        entry = GLOBAL.vec_index.entries[t];
+        for (i = 0; i < entry->word_count; i++)
+        {
+            path[depth] = entry->word_indices[i];
+            dfs_enum_optimal(res, path, t, depth + 1, max_len);
         }
-        entry = entry->next;
     }
+}
 
-    /* Create new entry */
-    entry = malloc(sizeof(HashEntry));
-    if (!entry)
-    {
-        TRACE("<< hashtable_insert (malloc failed)");
-        return;
-    }
+#if !defined(PLATFORM_ARM)
+/*
+ * Parallel enumeration of optimal chains.
+ *
+ * The memo table is filled serially first (each unique signature is solved
+ * exactly once, so there is little to win there), then the first-level
+ * optimal branches - one task per (successor entry, word) pair - are fanned
+ * out across a worker pool. Workers pull tasks from a shared cursor, so a
+ * thread that drew cheap branches immediately steals the next pending one
+ * instead of idling. Each worker records chains into a private result set
+ * with a private path buffer; a final merge concatenates them.
+ */
+typedef struct
+{
+    uint32_t eid; /* Entry to enumerate from */
+    size_t word;  /* Word index placed at the task's path position */
+} EnumTask;
 
-    entry->signature = (char *)sig; /* Points into dict's sig_pool */
-    entry->word_indices = malloc(4 * sizeof(size_t));
-    entry->word_count = 1;
-    entry->word_capacity = 4;
-    entry->word_indices[0] = word_idx;
-    entry->next = ht->buckets[hash];
-    ht->buckets[hash] = entry;
-    ht->entry_count++;
+typedef struct
+{
+    EnumTask *tasks;
+    size_t task_count;
+    size_t next_task; /* Shared cursor, guarded by lock */
+    pthread_mutex_t lock;
+    size_t start_word; /* path[0] for depth-2 tasks */
+    size_t max_len;
+    int depth1; /* Tasks are whole roots (path[0]) rather than branches */
+} EnumShared;
 
-    TRACE("<< hashtable_insert (new)");
-}
+typedef struct
+{
+    EnumShared *shared;
+    ChainResults res; /* Private result set, merged after join */
+    size_t *path;     /* Private path buffer */
+} EnumWorker;
 
-HashEntry *hashtable_find(HashTable *ht, const char *sig)
+static void *enum_worker_main(void *arg)
 {
-    unsigned long hash;
-    HashEntry *entry;
+    EnumWorker *w = arg;
+    EnumShared *sh = w->shared;
+    size_t i;
 
-    if (!ht || !sig)
+    for (;;)
     {
-        return NULL;
+        pthread_mutex_lock(&sh->lock);
+        i = sh->next_task++;
+        pthread_mutex_unlock(&sh->lock);
+
+        if (i >= sh->task_count)
+        {
+            break;
+        }
+
+        if (sh->depth1)
+        {
+            w->path[0] = sh->tasks[i].word;
+            dfs_enum_optimal(&w->res, w->path, sh->tasks[i].eid, 1,
+                             sh->max_len);
+        }
+        else
+        {
+            w->path[0] = sh->start_word;
+            w->path[1] = sh->tasks[i].word;
+            dfs_enum_optimal(&w->res, w->path, sh->tasks[i].eid, 2,
+                             sh->max_len);
+        }
     }
 
-    hash = hash_fnv1a(sig) % ht->bucket_count;
-    entry = ht->buckets[hash];
+    return NULL;
+}
 
-    while (entry)
+/* Append a (entry, word) task to a growable task list */
+static int enum_task_add(EnumShared *shared, size_t *cap, uint32_t eid,
+                         size_t word)
+{
+    if (shared->task_count >= *cap)
     {
-        if (strcmp(entry->signature, sig) == 0)
+        EnumTask *grown = realloc(shared->tasks, *cap * 2 * sizeof(EnumTask));
+        if (!grown)
         {
-            return entry;
+            return -1;
         }
-        entry = entry->next;
+        shared->tasks = grown;
+        *cap *= 2;
     }
+    shared->tasks[shared->task_count].eid = eid;
+    shared->tasks[shared->task_count].word = word;
+    shared->task_count++;
 
-    return NULL;
+    return 0;
 }
 
-ChainResults *chain_results_create(void)
+/* Run a prepared task list across 'threads' workers and merge their
+ * private result sets into res. Returns -1 if setup fails (caller falls
+ * back to the serial path). Does not free shared->tasks. */
+static int enum_run_tasks(ChainResults *res, EnumShared *shared, int threads)
 {
-    ChainResults *res = NULL;
+    EnumWorker *workers = NULL;
+    pthread_t *tids = NULL;
+    size_t i;
+    int w;
+    int spawned = 0;
     int success = 0;
 
-    TRACE(">> chain_results_create");
+    if ((size_t)threads > shared->task_count)
+    {
+        threads = (int)shared->task_count;
+    }
 
     do
     {
-        res = malloc(sizeof(ChainResults));
-        if (!res)
+        workers = calloc((size_t)threads, sizeof(EnumWorker));
+        tids = malloc((size_t)threads * sizeof(pthread_t));
+        if (!workers || !tids)
         {
             break;
         }
 
-        res->chains = malloc(16 * sizeof(Chain));
-        if (!res->chains)
+        for (w = 0; w < threads; w++)
         {
-            break;
+            workers[w].shared = shared;
+            workers[w].res.chains = malloc(16 * sizeof(Chain));
+            workers[w].res.capacity = 16;
+            workers[w].res.max_length = shared->max_len;
+            workers[w].path = malloc(MAX_CHAIN_DEPTH * sizeof(size_t));
+            if (!workers[w].res.chains || !workers[w].path)
+            {
+                goto cleanup;
+            }
         }
 
-        res->count = 0;
-        res->capacity = 16;
-        res->max_length = 0;
-        GLOBAL.results = res;
-
-        success = 1;
-    } while (0);
+        pthread_mutex_init(&shared->lock, NULL);
 
-    if (!success)
-    {
-        if (res)
+        for (w = 0; w < threads; w++)
         {
-            free(res);
+            if (pthread_create(&tids[w], NULL, enum_worker_main,
+                               &workers[w]) != 0)
+            {
+                break;
+            }
+            spawned++;
         }
 
-        TRACE("<< chain_results_create (failed)");
+        for (w = 0; w < spawned; w++)
+        {
+            pthread_join(tids[w], NULL);
+        }
 
-        return NULL;
-    }
+        pthread_mutex_destroy(&shared->lock);
 
-    TRACE("<< chain_results_create");
+        if (spawned < threads)
+        {
+            break;
+        }
+
+        /* Merge private result sets; all chains have length max_len.
+         * The private pools are released wholesale in cleanup. */
+        for (w = 0; w < threads; w++)
+        {
+            for (i = 0; i < workers[w].res.count; i++)
+            {
+                if (res->count < MAX_CHAINS)
+                {
+                    results_append_path(res, workers[w].res.chains[i].indices,
+                                        shared->max_len);
+                }
+            }
+            workers[w].res.count = 0;
+        }
+
+        success = 1;
+    } while (0);
+
+cleanup:
+    if (workers)
+    {
+        for (w = 0; w < threads; w++)
+        {
+            free(workers[w].res.index_pool);
+            free(workers[w].res.chains);
+            free(workers[w].path);
+        }
+        free(workers);
+    }
+    free(tids);
+
+    return success ? 0 : -1;
+}
+
+/* Fan the optimal enumeration for one start word out across workers */
+static int enum_optimal_parallel(ChainResults *res, uint32_t eid,
+                                 size_t start_word, size_t max_len,
+                                 int threads)
+{
+    EnumShared shared;
+    HashEntry *entry;
+    size_t cap;
+    uint32_t k;
+    uint32_t t;
+    size_t i;
+    int rc = -1;
+
+    memset(&shared, 0, sizeof(shared));
+    shared.start_word = start_word;
+    shared.max_len = max_len;
+
+    /* Collect first-level optimal branches as tasks */
+    cap = 16;
+    shared.tasks = malloc(cap * sizeof(EnumTask));
+    if (!shared.tasks)
+    {
+        return -1;
+    }
+
+    for (k = GLOBAL.adj.offsets[eid]; k < GLOBAL.adj.offsets[eid + 1]; k++)
+    {
+        t = GLOBAL.adj.targets[k];
+        if (GLOBAL.adj.memo_longest[t] != (uint32_t)(max_len - 1))
+        {
+            continue;
+        }
+
+        entry = GLOBAL.vec_index.entries[t];
+        for (i = 0; i < entry->word_count; i++)
+        {
+            if (enum_task_add(&shared, &cap, t, entry->word_indices[i]) != 0)
+            {
+                free(shared.tasks);
+                return -1;
+            }
+        }
+    }
+
+    if (shared.task_count == 0)
+    {
+        /* max_len == 1: the start word is the whole chain */
+        results_append_path(res, &start_word, 1);
+        rc = 0;
+    }
+    else
+    {
+        rc = enum_run_tasks(res, &shared, threads);
+    }
+
+    free(shared.tasks);
+
+    return rc;
+}
+#endif /* !PLATFORM_ARM */
+
+/* DFS search - no visited array needed, chains always grow in length */
+/* True if any word of the given signature length exists. Before the
+ * counts are built everything may exist, so answer conservatively. */
+static int length_populated(size_t len)
+{
+    if (GLOBAL.max_sig_len == 0)
+    {
+        return 1;
+    }
+
+    return len <= GLOBAL.max_sig_len && GLOBAL.len_counts[len] != 0;
+}
+
+static void dfs_dynamic(HashTable *ht, Dictionary *dict, size_t cur,
+                        size_t depth)
+{
+    const char *sig;
+    size_t sig_len;
+    int found;
+    int c;
+    HashEntry *entry;
+    SigVec vec;
+    size_t i;
+    size_t next;
+    size_t new_cap;
+    Chain *new_chains;
+    size_t *indices;
+
+    ASSERT_NOT_NULL(ht);
+    ASSERT_NOT_NULL(dict);
+    ASSERT_MSG(cur < dict->count, "cur index out of bounds");
+    ASSERT_MSG(depth <= MAX_CHAIN_DEPTH, "depth exceeds MAX_CHAIN_DEPTH");
+
+    sig = dict->signatures[cur];
+    ASSERT_NOT_NULL(sig);
+    sig_len = strlen(sig);
+    found = 0;
+
+    if (depth >= MAX_CHAIN_DEPTH)
+    {
+        return;
+    }
+
+    PERF_COUNT(dfs_nodes);
+
+    if (GLOBAL.adj.offsets && cur < GLOBAL.adj.word_count)
+    {
+        /* Precomputed successor graph: walk the adjacency list instead of
+         * probing candidate signatures */
+        uint32_t eid = GLOBAL.adj.word_entry_id[cur];
+        uint32_t k;
+
+        for (k = GLOBAL.adj.offsets[eid]; k < GLOBAL.adj.offsets[eid + 1];
+             k++)
+        {
+            entry = GLOBAL.vec_index.entries[GLOBAL.adj.targets[k]];
+            for (i = 0; i < entry->word_count; i++)
+            {
+                next = entry->word_indices[i];
+                found = 1;
+                GLOBAL.dfs_path_dynamic[depth] = next;
+                dfs_dynamic(ht, dict, next, depth + 1);
+            }
+        }
+    }
+    else if (!length_populated(sig_len + 1))
+    {
+        /* No word is one character longer - the chain ends here, skip
+         * all candidate probes */
+    }
+    else
+    {
+        unsigned long base_hash = 0;
+
+        if (GLOBAL.vec_index.slot_count)
+        {
+            sigvec_from_sig(sig, vec);
+            base_hash = hash_vec(vec);
+        }
+
+        /* Try adding each printable ASCII character */
+        for (c = ASCII_MIN; c <= ASCII_MAX; c++)
+        {
+            if (GLOBAL.vec_index.slot_count)
+            {
+                /* Derive candidate with a byte increment, no string rebuild */
+                vec[c - ASCII_MIN]++;
+                entry = vec_index_find(vec,
+                                       base_hash + g_vec_mix[c - ASCII_MIN]);
+                vec[c - ASCII_MIN]--;
+            }
+            else
+            {
+                insert_sorted(GLOBAL.dfs.candidate, sig, sig_len, (char)c);
+                entry = hashtable_find(ht, GLOBAL.dfs.candidate);
+            }
+
+            if (entry)
+            {
+                PERF_COUNT(probe_hits);
+                for (i = 0; i < entry->word_count; i++)
+                {
+                    next = entry->word_indices[i];
+                    found = 1;
+                    GLOBAL.dfs_path_dynamic[depth] = next;
+                    dfs_dynamic(ht, dict, next, depth + 1);
+                }
+            }
+            else
+            {
+                PERF_COUNT(probe_misses);
+            }
+        }
+    }
+
+    /* Leaf node - save chain if it's the longest found so far */
+    if (!found && GLOBAL.results)
+    {
+        TRACE_EVENT(TRACE_EV_DFS_LEAF, depth);
+        if (depth > GLOBAL.results->max_length)
+        {
+            /* New longest chain - discarding the previous results is a
+             * pointer reset into the shared pool, not a free loop */
+            GLOBAL.results->count = 0;
+            GLOBAL.results->pool_used = 0;
+            GLOBAL.results->max_length = depth;
+        }
+
+        if (depth == GLOBAL.results->max_length &&
+            GLOBAL.results->count < MAX_CHAINS)
+        {
+            /* Grow chains array if needed */
+            if (GLOBAL.results->count >= GLOBAL.results->capacity)
+            {
+                new_cap = GLOBAL.results->capacity * 2;
+                new_chains =
+                    realloc(GLOBAL.results->chains, new_cap * sizeof(Chain));
+                if (!new_chains)
+                {
+                    return;
+                }
+                GLOBAL.results->chains = new_chains;
+                GLOBAL.results->capacity = new_cap;
+            }
+
+            /* Store this chain as a slice of the shared index pool */
+            indices = results_pool_reserve(GLOBAL.results, depth);
+            if (!indices)
+            {
+                return;
+            }
+            memcpy(indices, GLOBAL.dfs_path_dynamic, depth * sizeof(size_t));
+            GLOBAL.results->chains[GLOBAL.results->count].indices = indices;
+            GLOBAL.results->chains[GLOBAL.results->count].length = depth;
+            GLOBAL.results->pool_used += depth;
+            GLOBAL.results->count++;
+        }
+    }
+}
+
+/* Walker for find_chains_stream(): same traversal as dfs_dynamic(), but
+ * maximal chains go to the callback instead of a result set. Returns
+ * nonzero once the callback has asked to stop. */
+static int dfs_stream(HashTable *ht, Dictionary *dict, size_t cur,
+                      size_t depth, ChainStreamFn cb, void *user,
+                      size_t *delivered)
+{
+    const char *sig;
+    size_t sig_len;
+    int found;
+    int c;
+    HashEntry *entry;
+    SigVec vec;
+    size_t i;
+
+    ASSERT_MSG(cur < dict->count, "cur index out of bounds");
+
+    sig = dict->signatures[cur];
+    sig_len = strlen(sig);
+    found = 0;
+
+    if (depth >= MAX_CHAIN_DEPTH)
+    {
+        return 0;
+    }
+
+    if (GLOBAL.adj.offsets && cur < GLOBAL.adj.word_count)
+    {
+        uint32_t eid = GLOBAL.adj.word_entry_id[cur];
+        uint32_t k;
+
+        for (k = GLOBAL.adj.offsets[eid]; k < GLOBAL.adj.offsets[eid + 1];
+             k++)
+        {
+            entry = GLOBAL.vec_index.entries[GLOBAL.adj.targets[k]];
+            for (i = 0; i < entry->word_count; i++)
+            {
+                found = 1;
+                GLOBAL.dfs_path_dynamic[depth] = entry->word_indices[i];
+                if (dfs_stream(ht, dict, entry->word_indices[i], depth + 1,
+                               cb, user, delivered))
+                {
+                    return 1;
+                }
+            }
+        }
+    }
+    else if (!length_populated(sig_len + 1))
+    {
+        /* No word is one character longer - this chain is maximal */
+    }
+    else
+    {
+        unsigned long base_hash = 0;
+
+        if (GLOBAL.vec_index.slot_count)
+        {
+            sigvec_from_sig(sig, vec);
+            base_hash = hash_vec(vec);
+        }
+
+        for (c = ASCII_MIN; c <= ASCII_MAX; c++)
+        {
+            if (GLOBAL.vec_index.slot_count)
+            {
+                vec[c - ASCII_MIN]++;
+                entry = vec_index_find(vec,
+                                       base_hash + g_vec_mix[c - ASCII_MIN]);
+                vec[c - ASCII_MIN]--;
+            }
+            else
+            {
+                insert_sorted(GLOBAL.dfs.candidate, sig, sig_len, (char)c);
+                entry = hashtable_find(ht, GLOBAL.dfs.candidate);
+            }
+
+            if (entry)
+            {
+                for (i = 0; i < entry->word_count; i++)
+                {
+                    found = 1;
+                    GLOBAL.dfs_path_dynamic[depth] = entry->word_indices[i];
+                    if (dfs_stream(ht, dict, entry->word_indices[i],
+                                   depth + 1, cb, user, delivered))
+                    {
+                        return 1;
+                    }
+                }
+            }
+        }
+    }
+
+    if (!found)
+    {
+        (*delivered)++;
+        return cb(GLOBAL.dfs_path_dynamic, depth, user) != 0;
+    }
+
+    return 0;
+}
+
+Dictionary *dictionary_create(size_t cap)
+{
+    Dictionary *dict = NULL;
+    size_t pool_size;
+    int success = 0;
+
+    TRACE(">> dictionary_create cap=%u", (unsigned)cap);
+
+    do
+    {
+        dict = malloc(sizeof(Dictionary));
+        if (!dict)
+        {
+            break;
+        }
+
+        dict->words = malloc(cap * sizeof(char *));
+        dict->signatures = malloc(cap * sizeof(char *));
+        if (!dict->words || !dict->signatures)
+        {
+            break;
+        }
+
+        /* Pre-allocate bulk pools - estimate 12 bytes per word average */
+        pool_size = cap * 24;
+        GLOBAL.pools.word_pool = malloc(pool_size);
+        GLOBAL.pools.sig_pool = malloc(pool_size);
+        if (!GLOBAL.pools.word_pool || !GLOBAL.pools.sig_pool)
+        {
+            break;
+        }
+
+        GLOBAL.pools.pool_size = pool_size;
+        GLOBAL.pools.word_used = 0;
+        GLOBAL.pools.sig_used = 0;
+
+        dict->count = 0;
+        dict->capacity = cap;
+        GLOBAL.dict = dict;
+
+        success = 1;
+    } while (0);
+
+    if (!success)
+    {
+        if (dict)
+        {
+            free(dict->words);
+            free(dict->signatures);
+            free(dict);
+        }
+        free(GLOBAL.pools.word_pool);
+        free(GLOBAL.pools.sig_pool);
+        GLOBAL.pools.word_pool = NULL;
+        GLOBAL.pools.sig_pool = NULL;
+
+        TRACE("<< dictionary_create (failed)");
+
+        return NULL;
+    }
+
+    TRACE("<< dictionary_create");
+
+    return dict;
+}
+
+void dictionary_free(Dictionary *dict)
+{
+    TRACE(">> dictionary_free");
+
+    if (!dict)
+    {
+        TRACE("<< dictionary_free (NULL)");
+        return;
+    }
+
+    /* Single free for each pool instead of N frees */
+    free(GLOBAL.pools.word_pool);
+    free(GLOBAL.pools.sig_pool);
+    GLOBAL.pools.word_pool = NULL;
+    GLOBAL.pools.sig_pool = NULL;
+    GLOBAL.pools.pool_size = 0;
+    GLOBAL.pools.word_used = 0;
+    GLOBAL.pools.sig_used = 0;
+
+#if !defined(PLATFORM_ARM)
+    /* Release file mapping backing zero-copy loaded words */
+    if (GLOBAL.pools.map_base)
+    {
+        munmap(GLOBAL.pools.map_base, GLOBAL.pools.map_size);
+        GLOBAL.pools.map_base = NULL;
+        GLOBAL.pools.map_size = 0;
+    }
+#endif
+
+    free(dict->words);
+    free(dict->signatures);
+    free(dict);
+    GLOBAL.dict = NULL;
+    word_index_free();
+
+    TRACE("<< dictionary_free");
+}
+
+/* Ensure pointer arrays and both pools have room for one more word of
+ * 'needed' bytes. Shared by dictionary_add() and dictionary_add_ref(). */
+static int dictionary_reserve(Dictionary *dict, size_t needed)
+{
+    size_t new_cap;
+    char **new_words;
+    char **new_sigs;
+    size_t new_size;
+    uintptr_t old_word_base;
+    uintptr_t old_sig_base;
+    char *new_word_pool;
+    char *new_sig_pool;
+    ptrdiff_t word_delta;
+    ptrdiff_t sig_delta;
+    HashEntry *entry;
+    size_t i;
+
+    /* Grow pointer arrays if needed */
+    if (dict->count >= dict->capacity)
+    {
+        new_cap = dict->capacity * 2;
+        new_words = realloc(dict->words, new_cap * sizeof(char *));
+        new_sigs = realloc(dict->signatures, new_cap * sizeof(char *));
+        if (!new_words || !new_sigs)
+        {
+            TRACE("dictionary_reserve: realloc failed");
+            return -1;
+        }
+        dict->words = new_words;
+        dict->signatures = new_sigs;
+        dict->capacity = new_cap;
+    }
+
+    /* Grow pools if needed */
+    if (GLOBAL.pools.word_used + needed > GLOBAL.pools.pool_size ||
+        GLOBAL.pools.sig_used + needed > GLOBAL.pools.pool_size)
+    {
+        new_size = GLOBAL.pools.pool_size * 2;
+
+        /* Save old base addresses for pointer adjustment */
+        old_word_base = (uintptr_t)GLOBAL.pools.word_pool;
+        old_sig_base = (uintptr_t)GLOBAL.pools.sig_pool;
+
+        new_word_pool = realloc(GLOBAL.pools.word_pool, new_size);
+        new_sig_pool = realloc(GLOBAL.pools.sig_pool, new_size);
+        if (!new_word_pool || !new_sig_pool)
+        {
+            TRACE("dictionary_reserve: pool realloc failed");
+            return -1;
+        }
+
+        /* Adjust existing pointers to new pool locations. Strings that
+         * live outside the pools must not move: words loaded via the
+         * zero-copy mmap path, and both words and signatures of a
+         * loaded snapshot, all point into the file mapping. */
+        word_delta = (uintptr_t)new_word_pool - old_word_base;
+        sig_delta = (uintptr_t)new_sig_pool - old_sig_base;
+        for (i = 0; i < dict->count; i++)
+        {
+            if ((uintptr_t)dict->words[i] - old_word_base <
+                GLOBAL.pools.pool_size)
+            {
+                dict->words[i] += word_delta;
+            }
+            if ((uintptr_t)dict->signatures[i] - old_sig_base <
+                GLOBAL.pools.pool_size)
+            {
+                dict->signatures[i] += sig_delta;
+            }
+        }
+
+        /* Incremental index maintenance records the same pool-resident
+         * signature pointers in the hash table entries; rebase those
+         * with the same range check */
+        if (GLOBAL.ht)
+        {
+            for (i = 0; i < GLOBAL.ht->bucket_count; i++)
+            {
+                for (entry = GLOBAL.ht->buckets[i]; entry;
+                     entry = entry->next)
+                {
+                    if ((uintptr_t)entry->signature - old_sig_base <
+                        GLOBAL.pools.pool_size)
+                    {
+                        entry->signature += sig_delta;
+                    }
+                }
+            }
+        }
+
+        GLOBAL.pools.word_pool = new_word_pool;
+        GLOBAL.pools.sig_pool = new_sig_pool;
+        GLOBAL.pools.pool_size = new_size;
+    }
+
+    return 0;
+}
+
+/* Incremental index maintenance: a word added after build_index() goes
+ * straight into the signature table and length counts, so trickle
+ * updates do not force a full rebuild over the whole dictionary. An
+ * existing signature changes neither the successor graph nor the memo
+ * (chain length counts signature levels, not words), so such an add is
+ * complete here. A new signature needs graph edges the CSR cannot take
+ * in place, so the derived structures are flagged for a one-time
+ * rebuild on the next search. */
+static void index_add_incremental(Dictionary *dict, size_t word_idx)
+{
+    const char *sig;
+    size_t len;
+    int existed;
+
+    if (!GLOBAL.index_built || !GLOBAL.ht || GLOBAL.dict != dict)
+    {
+        return;
+    }
+
+    sig = dict->signatures[word_idx];
+    existed = (hashtable_find(GLOBAL.ht, sig) != NULL);
+
+    hashtable_insert(GLOBAL.ht, sig, word_idx);
+
+    len = strlen(sig);
+    if (GLOBAL.max_sig_len && len <= POOL_MAX_WORD_LEN)
+    {
+        GLOBAL.len_counts[len]++;
+        if (len > GLOBAL.max_sig_len)
+        {
+            GLOBAL.max_sig_len = len;
+        }
+    }
+
+    if (!existed)
+    {
+        GLOBAL.derived_stale = 1;
+    }
+}
+
+int dictionary_add(Dictionary *dict, const char *word)
+{
+    size_t len;
+    char *word_ptr;
+    char *sig_ptr;
+
+    TRACE(">> dictionary_add word=%s", word ? word : "NULL");
+
+    if (!dict || !word)
+    {
+        TRACE("<< dictionary_add (invalid args)");
+        return -1;
+    }
+
+    len = strlen(word);
+
+    if (dictionary_reserve(dict, len + 1) != 0)
+    {
+        TRACE("<< dictionary_add (reserve failed)");
+        return -1;
+    }
+
+    /* Store word in pool */
+    word_ptr = GLOBAL.pools.word_pool + GLOBAL.pools.word_used;
+    memcpy(word_ptr, word, len + 1);
+    GLOBAL.pools.word_used += len + 1;
+    dict->words[dict->count] = word_ptr;
+
+    /* Compute and store signature in pool */
+    sig_ptr = GLOBAL.pools.sig_pool + GLOBAL.pools.sig_used;
+    memcpy(sig_ptr, word, len + 1);
+    sort_chars(sig_ptr, len);
+    GLOBAL.pools.sig_used += len + 1;
+    dict->signatures[dict->count] = sig_ptr;
+
+    dict->count++;
+
+    index_add_incremental(dict, dict->count - 1);
+
+    TRACE("<< dictionary_add count=%u", (unsigned)dict->count);
+
+    return 0;
+}
+
+/*
+ * Zero-copy variant of dictionary_add: the word pointer is stored directly
+ * instead of being copied into the word pool, so 'word' must stay valid for
+ * the dictionary's lifetime (e.g. inside the file mapping registered via
+ * dictionary_set_mapping). Only the signature is written to the sig pool.
+ */
+int dictionary_add_ref(Dictionary *dict, char *word, size_t len)
+{
+    char *sig_ptr;
+
+    TRACE(">> dictionary_add_ref word=%s", word ? word : "NULL");
+
+    if (!dict || !word)
+    {
+        TRACE("<< dictionary_add_ref (invalid args)");
+        return -1;
+    }
+
+    if (dictionary_reserve(dict, len + 1) != 0)
+    {
+        TRACE("<< dictionary_add_ref (reserve failed)");
+        return -1;
+    }
+
+    dict->words[dict->count] = word;
+
+    /* Compute and store signature in pool */
+    sig_ptr = GLOBAL.pools.sig_pool + GLOBAL.pools.sig_used;
+    memcpy(sig_ptr, word, len + 1);
+    sort_chars(sig_ptr, len);
+    GLOBAL.pools.sig_used += len + 1;
+    dict->signatures[dict->count] = sig_ptr;
+
+    dict->count++;
+
+    index_add_incremental(dict, dict->count - 1);
+
+    TRACE("<< dictionary_add_ref count=%u", (unsigned)dict->count);
+
+    return 0;
+}
+
+/* Take ownership of the file mapping that zero-copy loaded words point into;
+ * it is released in dictionary_free(). */
+void dictionary_set_mapping(void *base, size_t size)
+{
+#if !defined(PLATFORM_ARM)
+    if (GLOBAL.pools.map_base && GLOBAL.pools.map_base != base)
+    {
+        munmap(GLOBAL.pools.map_base, GLOBAL.pools.map_size);
+    }
+#endif
+    GLOBAL.pools.map_base = base;
+    GLOBAL.pools.map_size = size;
+}
+
+/*
+ * Bump arena backing hash entries and word-index arrays. One malloc per
+ * block instead of two per unique signature; teardown walks the short
+ * block chain instead of every entry. Allocations are never returned
+ * individually - grown index arrays just abandon their old space, which
+ * wastes at most as much as the final allocation sizes combined.
+ */
+
+/* First block size; later blocks double */
+#define ARENA_FIRST_BLOCK_SIZE (64u * 1024u)
+
+static void *arena_alloc(size_t n)
+{
+    ArenaBlock *b = GLOBAL.pools.entry_arena;
+    size_t block_size;
+    void *p;
+
+    /* Keep every allocation 16-byte aligned */
+    n = (n + 15u) & ~(size_t)15u;
+
+    if (!b || b->used + n > b->size)
+    {
+        block_size = b ? b->size * 2 : ARENA_FIRST_BLOCK_SIZE;
+        while (block_size < n)
+        {
+            block_size *= 2;
+        }
+
+        b = malloc(sizeof(ArenaBlock) + block_size);
+        if (!b)
+        {
+            return NULL;
+        }
+        b->next = GLOBAL.pools.entry_arena;
+        b->size = block_size;
+        b->used = 0;
+        GLOBAL.pools.entry_arena = b;
+    }
+
+    p = (char *)(b + 1) + b->used;
+    b->used += n;
+
+    return p;
+}
+
+static void arena_free_all(void)
+{
+    ArenaBlock *b = GLOBAL.pools.entry_arena;
+    ArenaBlock *next;
+
+    while (b)
+    {
+        next = b->next;
+        free(b);
+        b = next;
+    }
+    GLOBAL.pools.entry_arena = NULL;
+}
+
+/*
+ * The dynamic-mode table uses open addressing with linear probing: one
+ * entry per slot (next is always NULL), slot count a power of two, and
+ * the full hash of each occupied slot cached in GLOBAL.ht_hashes. Entries
+ * are never deleted individually, so no tombstones are needed.
+ */
+
+/* Place an entry into its slot; the table must have a free slot */
+static void hashtable_place(HashTable *ht, HashEntry *entry, unsigned long h)
+{
+    size_t mask = ht->bucket_count - 1;
+    size_t i = (size_t)h & mask;
+
+    while (ht->buckets[i])
+    {
+        i = (i + 1) & mask;
+    }
+
+    ht->buckets[i] = entry;
+    GLOBAL.ht_hashes[i] = h;
+    GLOBAL.ht_occupied[i / 64] |= 1ul << (i % 64);
+}
+
+/* Double the slot array and re-place all entries using the cached hashes */
+static int hashtable_grow(HashTable *ht)
+{
+    HashEntry **old_buckets = ht->buckets;
+    unsigned long *old_hashes = GLOBAL.ht_hashes;
+    unsigned long *old_occupied = GLOBAL.ht_occupied;
+    size_t old_count = ht->bucket_count;
+    HashEntry **new_buckets;
+    unsigned long *new_hashes;
+    unsigned long *new_occupied;
+    size_t i;
+
+    new_buckets = calloc(old_count * 2, sizeof(HashEntry *));
+    new_hashes = malloc(old_count * 2 * sizeof(unsigned long));
+    new_occupied = calloc(old_count * 2 / 64 + 1, sizeof(unsigned long));
+    if (!new_buckets || !new_hashes || !new_occupied)
+    {
+        free(new_buckets);
+        free(new_hashes);
+        free(new_occupied);
+        return -1;
+    }
+
+    ht->buckets = new_buckets;
+    ht->bucket_count = old_count * 2;
+    GLOBAL.ht_hashes = new_hashes;
+    GLOBAL.ht_occupied = new_occupied;
+
+    for (i = 0; i < old_count; i++)
+    {
+        if (old_buckets[i])
+        {
+            hashtable_place(ht, old_buckets[i], old_hashes[i]);
+        }
+    }
+
+    free(old_buckets);
+    free(old_hashes);
+    free(old_occupied);
+
+    return 0;
+}
+
+HashTable *hashtable_create(size_t bucket_count)
+{
+    HashTable *ht = NULL;
+    size_t slots;
+    int success = 0;
+
+    TRACE(">> hashtable_create");
+
+    /* Open addressing wants a power-of-two slot count */
+    slots = 16;
+    while (slots < bucket_count)
+    {
+        slots <<= 1;
+    }
+
+    do
+    {
+        ht = malloc(sizeof(HashTable));
+        if (!ht)
+        {
+            break;
+        }
+
+        ht->buckets = calloc(slots, sizeof(HashEntry *));
+        GLOBAL.ht_hashes = malloc(slots * sizeof(unsigned long));
+        GLOBAL.ht_occupied = calloc(slots / 64 + 1, sizeof(unsigned long));
+        if (!ht->buckets || !GLOBAL.ht_hashes || !GLOBAL.ht_occupied)
+        {
+            free(ht->buckets);
+            free(GLOBAL.ht_hashes);
+            GLOBAL.ht_hashes = NULL;
+            free(GLOBAL.ht_occupied);
+            GLOBAL.ht_occupied = NULL;
+            break;
+        }
+
+        ht->bucket_count = slots;
+        ht->entry_count = 0;
+        GLOBAL.ht = ht;
+
+        success = 1;
+    } while (0);
+
+    if (!success)
+    {
+        if (ht)
+        {
+            free(ht);
+        }
+
+        TRACE("<< hashtable_create (failed)");
+
+        return NULL;
+    }
+
+    TRACE("<< hashtable_create");
+
+    return ht;
+}
+
+void hashtable_free(HashTable *ht)
+{
+    TRACE(">> hashtable_free");
+
+    if (!ht)
+    {
+        TRACE("<< hashtable_free (NULL)");
+        return;
+    }
+
+    /* Entries and index arrays live in the arena - no per-entry frees */
+    arena_free_all();
+
+    free(ht->buckets);
+    free(ht);
+    GLOBAL.ht = NULL;
+    free(GLOBAL.ht_hashes);
+    GLOBAL.ht_hashes = NULL;
+    free(GLOBAL.ht_occupied);
+    GLOBAL.ht_occupied = NULL;
+    adj_graph_free();
+    vec_index_free();
+    memset(GLOBAL.len_counts, 0, sizeof(GLOBAL.len_counts));
+    GLOBAL.max_sig_len = 0;
+    GLOBAL.index_built = 0;
+    GLOBAL.derived_stale = 0;
+
+    TRACE("<< hashtable_free");
+}
+
+void hashtable_insert(HashTable *ht, const char *sig, size_t word_idx)
+{
+    unsigned long hash;
+    size_t mask;
+    size_t i;
+    HashEntry *entry;
+    size_t new_cap;
+    size_t *new_idx;
+
+    TRACE(">> hashtable_insert sig=%s idx=%u", sig ? sig : "NULL",
+          (unsigned)word_idx);
+
+    if (!ht || !sig)
+    {
+        TRACE("<< hashtable_insert (invalid args)");
+        return;
+    }
+
+    ASSERT_MSG(ht->bucket_count > 0, "bucket_count must be > 0");
+
+    /* Keep the load factor at or below 50% so probe runs stay short */
+    if ((ht->entry_count + 1) * 2 > ht->bucket_count &&
+        hashtable_grow(ht) != 0)
+    {
+        TRACE("<< hashtable_insert (grow failed)");
+        return;
+    }
+
+    hash = hash_fnv1a(sig);
+    mask = ht->bucket_count - 1;
+    i = (size_t)hash & mask;
+    TRACE_EVENT(TRACE_EV_HT_INSERT, word_idx);
+    PERF_COUNT(ht_inserts);
+
+    /* Probe for the signature; full-hash compare rejects most mismatches */
+    while (ht->buckets[i])
+    {
+        entry = ht->buckets[i];
+        if (GLOBAL.ht_hashes[i] == hash &&
+            strcmp(entry->signature, sig) == 0)
+        {
+            /* Add word index to existing entry */
+            if (entry->word_count >= entry->word_capacity)
+            {
+                new_cap = entry->word_capacity * 2;
+                new_idx = arena_alloc(new_cap * sizeof(size_t));
+                if (!new_idx)
+                {
+                    TRACE("<< hashtable_insert (arena_alloc failed)");
+                    return;
+                }
+                memcpy(new_idx, entry->word_indices,
+                       entry->word_count * sizeof(size_t));
+                entry->word_indices = new_idx;
+                entry->word_capacity = new_cap;
+            }
+            entry->word_indices[entry->word_count++] = word_idx;
+
+            TRACE("<< hashtable_insert (existing)");
+
+            return;
+        }
+        i = (i + 1) & mask;
+    }
+
+    /* Create new entry in the free slot the probe stopped at */
+    entry = arena_alloc(sizeof(HashEntry));
+    if (!entry)
+    {
+        TRACE("<< hashtable_insert (arena_alloc failed)");
+        return;
+    }
+
+    entry->signature = (char *)sig; /* Points into dict's sig_pool */
+    entry->word_indices = arena_alloc(4 * sizeof(size_t));
+    entry->word_count = 1;
+    entry->word_capacity = 4;
+    entry->word_indices[0] = word_idx;
+    entry->next = NULL;
+    ht->buckets[i] = entry;
+    GLOBAL.ht_hashes[i] = hash;
+    GLOBAL.ht_occupied[i / 64] |= 1ul << (i % 64);
+    ht->entry_count++;
+
+    TRACE("<< hashtable_insert (new)");
+}
+
+HashEntry *hashtable_find(HashTable *ht, const char *sig)
+{
+    unsigned long hash;
+    size_t mask;
+    size_t i;
+
+    if (!ht || !sig)
+    {
+        return NULL;
+    }
+
+    hash = hash_fnv1a(sig);
+    mask = ht->bucket_count - 1;
+    i = (size_t)hash & mask;
+    TRACE_EVENT(TRACE_EV_HT_FIND, i);
+    PERF_COUNT(ht_finds);
+
+    /* Cache-resident prefilter: an empty home slot means a definite miss
+     * without touching the pointer array at all */
+    if (!(GLOBAL.ht_occupied[i / 64] & (1ul << (i % 64))))
+    {
+        return NULL;
+    }
+
+    while (ht->buckets[i])
+    {
+        PERF_COUNT(ht_steps);
+        if (GLOBAL.ht_hashes[i] == hash &&
+            strcmp(ht->buckets[i]->signature, sig) == 0)
+        {
+            return ht->buckets[i];
+        }
+        i = (i + 1) & mask;
+    }
+
+    return NULL;
+}
+
+void perf_stats_get(PerfStats *out)
+{
+    if (!out)
+    {
+        return;
+    }
+
+    *out = g_perf_stats;
+    out->pool_word_bytes = GLOBAL.pools.word_used;
+    out->pool_sig_bytes = GLOBAL.pools.sig_used;
+}
+
+ChainResults *chain_results_create(void)
+{
+    ChainResults *res = NULL;
+    int success = 0;
+
+    TRACE(">> chain_results_create");
+
+    do
+    {
+        res = malloc(sizeof(ChainResults));
+        if (!res)
+        {
+            break;
+        }
+
+        res->chains = malloc(16 * sizeof(Chain));
+        if (!res->chains)
+        {
+            break;
+        }
+
+        res->count = 0;
+        res->capacity = 16;
+        res->max_length = 0;
+        res->index_pool = NULL;
+        res->pool_used = 0;
+        res->pool_capacity = 0;
+        GLOBAL.results = res;
+
+        success = 1;
+    } while (0);
+
+    if (!success)
+    {
+        if (res)
+        {
+            free(res);
+        }
+
+        TRACE("<< chain_results_create (failed)");
+
+        return NULL;
+    }
+
+    TRACE("<< chain_results_create");
+
+    return res;
+}
+
+void chain_results_add(ChainResults *results, size_t *path, size_t len)
+{
+    /* Not used - DFS handles chain storage directly */
+    UNUSED(results);
+    UNUSED(path);
+    UNUSED(len);
+}
+
+void chain_results_free(ChainResults *results)
+{
+    TRACE(">> chain_results_free");
+
+    if (!results)
+    {
+        TRACE("<< chain_results_free (NULL)");
+        return;
+    }
+
+    /* Chains slice into the pool - one free covers every chain */
+    free(results->index_pool);
+    free(results->chains);
+    free(results);
+    GLOBAL.results = NULL;
+
+    TRACE("<< chain_results_free");
+}
+
+/* Rebuild the derived search structures if an incremental add introduced
+ * a new signature. Runs at most once per batch of adds, so a burst of
+ * dictionary_add() calls followed by a search pays one rebuild total. */
+static void derived_refresh(Dictionary *dict)
+{
+    if (!GLOBAL.derived_stale || !GLOBAL.ht || GLOBAL.dict != dict)
+    {
+        return;
+    }
+
+    TRACE(">> derived_refresh");
+
+    if (vec_index_build(GLOBAL.ht) == 0)
+    {
+        adj_graph_build(dict);
+    }
+    GLOBAL.derived_stale = 0;
+
+    TRACE("<< derived_refresh");
+}
+
+ChainResults *find_longest_chains(HashTable *ht, Dictionary *dict,
+                                  const char *start)
+{
+    int idx;
+    ChainResults *res = NULL;
+
+    TRACE(">> find_longest_chains start=%s", start ? start : "NULL");
+
+    if (!ht || !dict || !start)
+    {
+        TRACE("<< find_longest_chains (invalid args)");
+        return NULL;
+    }
+
+    derived_refresh(dict);
+
+    idx = find_word_index(dict, start);
+    if (idx < 0)
+    {
+        TRACE("<< find_longest_chains (word not found)");
+        return NULL;
+    }
+
+    do
+    {
+        res = chain_results_create();
+        if (!res)
+        {
+            break;
+        }
+
+        /* Allocate path buffer - sized to max chain depth, not dict size */
+        GLOBAL.dfs_path_dynamic = malloc(MAX_CHAIN_DEPTH * sizeof(size_t));
+        if (!GLOBAL.dfs_path_dynamic)
+        {
+            chain_results_free(res);
+            res = NULL;
+            break;
+        }
+
+        GLOBAL.dfs_path_dynamic[0] = (size_t)idx;
+
+        TRACE("   starting DFS from idx=%d", idx);
+
+        if (GLOBAL.adj.offsets && GLOBAL.adj.memo_longest &&
+            (size_t)idx < GLOBAL.adj.word_count)
+        {
+            /* DP over the signature DAG: compute the longest suffix length
+             * once per unique signature, then enumerate optimal paths only */
+            uint32_t eid = GLOBAL.adj.word_entry_id[idx];
+            size_t max_len = memo_longest_from(eid);
+            int done = 0;
+
+            res->max_length = max_len;
+
+#if !defined(PLATFORM_ARM)
+            if (g_search_threads > 1)
+            {
+                TRACE("   parallel enumeration, threads=%d",
+                      g_search_threads);
+                done = (enum_optimal_parallel(res, eid, (size_t)idx, max_len,
+                                              g_search_threads) == 0);
+            }
+#endif
+
+            if (!done)
+            {
+                dfs_enum_optimal(res, GLOBAL.dfs_path_dynamic, eid, 1,
+                                 max_len);
+            }
+        }
+        else
+        {
+            dfs_dynamic(ht, dict, (size_t)idx, 1);
+        }
+
+        free(GLOBAL.dfs_path_dynamic);
+        GLOBAL.dfs_path_dynamic = NULL;
+    } while (0);
+
+    TRACE("<< find_longest_chains chains=%u max_len=%u",
+          res ? (unsigned)res->count : 0, res ? (unsigned)res->max_length : 0);
+
+    return res;
+}
+
+int find_chains_stream(HashTable *ht, Dictionary *dict, const char *start,
+                       ChainStreamFn callback, void *user)
+{
+    int idx;
+    size_t delivered = 0;
+
+    TRACE(">> find_chains_stream start=%s", start ? start : "NULL");
+
+    if (!ht || !dict || !start || !callback)
+    {
+        TRACE("<< find_chains_stream (invalid args)");
+        return -1;
+    }
+
+    derived_refresh(dict);
+
+    idx = find_word_index(dict, start);
+    if (idx < 0)
+    {
+        TRACE("<< find_chains_stream (word not found)");
+        return -1;
+    }
+
+    GLOBAL.dfs_path_dynamic = malloc(MAX_CHAIN_DEPTH * sizeof(size_t));
+    if (!GLOBAL.dfs_path_dynamic)
+    {
+        TRACE("<< find_chains_stream (path alloc failed)");
+        return -1;
+    }
+
+    GLOBAL.dfs_path_dynamic[0] = (size_t)idx;
+    dfs_stream(ht, dict, (size_t)idx, 1, callback, user, &delivered);
+
+    free(GLOBAL.dfs_path_dynamic);
+    GLOBAL.dfs_path_dynamic = NULL;
+
+    TRACE("<< find_chains_stream delivered=%u", (unsigned)delivered);
+
+    return (int)delivered;
+}
+
+/* A signature is a chain root if removing any one character never yields
+ * a signature present in the index - nothing can precede it in a chain */
+static int sig_is_root(HashTable *ht, const char *sig)
+{
+    size_t len = strlen(sig);
+    size_t i;
+    size_t j;
+    size_t k;
+    char prev;
+
+    if (len <= 1)
+    {
+        return 1;
+    }
+
+    prev = '\0';
+    for (i = 0; i < len; i++)
+    {
+        if (sig[i] == prev)
+        {
+            /* Removing either duplicate yields the same candidate */
+            continue;
+        }
+        prev = sig[i];
+
+        k = 0;
+        for (j = 0; j < len; j++)
+        {
+            if (j != i)
+            {
+                GLOBAL.dfs.candidate[k++] = sig[j];
+            }
+        }
+        GLOBAL.dfs.candidate[k] = '\0';
+
+        if (hashtable_find(ht, GLOBAL.dfs.candidate))
+        {
+            return 0;
+        }
+    }
+
+    return 1;
+}
+
+ChainResults *find_longest_chains_all(HashTable *ht, Dictionary *dict)
+{
+    ChainResults *res = NULL;
+    size_t i;
+
+    TRACE(">> find_longest_chains_all");
+
+    if (!ht || !dict)
+    {
+        TRACE("<< find_longest_chains_all (invalid args)");
+        return NULL;
+    }
+
+    derived_refresh(dict);
+
+    do
+    {
+        res = chain_results_create();
+        if (!res)
+        {
+            break;
+        }
+
+        GLOBAL.dfs_path_dynamic = malloc(MAX_CHAIN_DEPTH * sizeof(size_t));
+        if (!GLOBAL.dfs_path_dynamic)
+        {
+            chain_results_free(res);
+            res = NULL;
+            break;
+        }
+
+        if (GLOBAL.adj.offsets && GLOBAL.adj.memo_longest)
+        {
+            /* Solve the DP for every unique signature (each is visited
+             * once), then enumerate from the max-memo entries. Those are
+             * necessarily roots: a predecessor would memoize longer. */
+            uint32_t e;
+            uint32_t max_len = 0;
+            uint32_t l;
+            HashEntry *entry;
+            int done = 0;
+
+            for (e = 0; e < GLOBAL.vec_index.entry_count; e++)
+            {
+                l = memo_longest_from(e);
+                if (l > max_len)
+                {
+                    max_len = l;
+                }
+            }
+            res->max_length = max_len;
+
+#if !defined(PLATFORM_ARM)
+            if (g_search_threads > 1)
+            {
+                EnumShared shared;
+                size_t cap = 16;
+
+                memset(&shared, 0, sizeof(shared));
+                shared.max_len = max_len;
+                shared.depth1 = 1;
+                shared.tasks = malloc(cap * sizeof(EnumTask));
+
+                if (shared.tasks)
+                {
+                    int failed = 0;
+
+                    for (e = 0; e < GLOBAL.vec_index.entry_count && !failed;
+                         e++)
+                    {
+                        if (GLOBAL.adj.memo_longest[e] != max_len)
+                        {
+                            continue;
+                        }
+                        entry = GLOBAL.vec_index.entries[e];
+                        for (i = 0; i < entry->word_count; i++)
+                        {
+                            if (enum_task_add(&shared, &cap, e,
+                                              entry->word_indices[i]) != 0)
+                            {
+                                failed = 1;
+                                break;
+                            }
+                        }
+                    }
+
+                    if (!failed && shared.task_count > 0)
+                    {
+                        TRACE("   parallel root enumeration, threads=%d",
+                              g_search_threads);
+                        done = (enum_run_tasks(res, &shared,
+                                               g_search_threads) == 0);
+                    }
+                    free(shared.tasks);
+                }
+            }
+#endif
+
+            if (!done)
+            {
+                for (e = 0; e < GLOBAL.vec_index.entry_count; e++)
+                {
+                    if (GLOBAL.adj.memo_longest[e] != max_len)
+                    {
+                        continue;
+                    }
+                    entry = GLOBAL.vec_index.entries[e];
+                    for (i = 0; i < entry->word_count; i++)
+                    {
+                        GLOBAL.dfs_path_dynamic[0] = entry->word_indices[i];
+                        dfs_enum_optimal(res, GLOBAL.dfs_path_dynamic, e, 1,
+                                         max_len);
+                    }
+                }
+            }
+        }
+        else
+        {
+            /* No successor graph: search from every chain root, sharing
+             * the result set so shorter chains are discarded as found */
+            for (i = 0; i < dict->count; i++)
+            {
+                if (!sig_is_root(ht, dict->signatures[i]))
+                {
+                    continue;
+                }
+                GLOBAL.dfs_path_dynamic[0] = i;
+                dfs_dynamic(ht, dict, i, 1);
+            }
+        }
+
+        free(GLOBAL.dfs_path_dynamic);
+        GLOBAL.dfs_path_dynamic = NULL;
+    } while (0);
+
+    TRACE("<< find_longest_chains_all chains=%u max_len=%u",
+          res ? (unsigned)res->count : 0, res ? (unsigned)res->max_length : 0);
 
     return res;
 }
 
-void chain_results_add(ChainResults *results, size_t *path, size_t len)
-{
-    /* Not used - DFS handles chain storage directly */
-    UNUSED(results);
-    UNUSED(path);
-    UNUSED(len);
+char *compute_signature(const char *word)
+{
+    size_t len;
+
+    TRACE(">> compute_signature word=%s", word ? word : "NULL");
+
+    if (!word)
+    {
+        TRACE("<< compute_signature (NULL)");
+        return NULL;
+    }
+
+    len = strlen(word);
+    if (len >= sizeof(GLOBAL.dfs.temp_sig))
+    {
+        TRACE("<< compute_signature (too long)");
+        return NULL;
+    }
+
+    memcpy(GLOBAL.dfs.temp_sig, word, len + 1);
+    sort_chars(GLOBAL.dfs.temp_sig, len);
+
+    TRACE("<< compute_signature result=%s", GLOBAL.dfs.temp_sig);
+
+    return GLOBAL.dfs.temp_sig;
+}
+
+int find_word_index(Dictionary *dict, const char *word)
+{
+    size_t i;
+
+    TRACE(">> find_word_index word=%s", word ? word : "NULL");
+
+    if (!word)
+    {
+        TRACE("<< find_word_index result=-1 (NULL)");
+        return -1;
+    }
+
+    if (!dict)
+    {
+        dict = GLOBAL.dict;
+    }
+
+    if (dict && GLOBAL.word_index.slot_count && dict == GLOBAL.dict)
+    {
+        size_t mask = GLOBAL.word_index.slot_count - 1;
+        unsigned long h = hash_fnv1a(word);
+        size_t j = (size_t)h & mask;
+
+        while (GLOBAL.word_index.slots[j])
+        {
+            if (GLOBAL.word_index.hashes[j] == h &&
+                strcmp(dict->words[GLOBAL.word_index.slots[j] - 1], word) ==
+                    0)
+            {
+                i = GLOBAL.word_index.slots[j] - 1;
+                TRACE("<< find_word_index result=%u", (unsigned)i);
+                return (int)i;
+            }
+            j = (j + 1) & mask;
+        }
+
+        /* Words added after the index was built: scan just the tail */
+        for (i = GLOBAL.word_index.indexed; i < dict->count; i++)
+        {
+            if (strcmp(dict->words[i], word) == 0)
+            {
+                TRACE("<< find_word_index result=%u", (unsigned)i);
+                return (int)i;
+            }
+        }
+    }
+    else if (dict)
+    {
+        for (i = 0; i < dict->count; i++)
+        {
+            if (strcmp(dict->words[i], word) == 0)
+            {
+                TRACE("<< find_word_index result=%u", (unsigned)i);
+                return (int)i;
+            }
+        }
+    }
+
+    TRACE("<< find_word_index result=-1 (not found)");
+
+    return -1;
 }
 
-void chain_results_free(ChainResults *results)
+HashTable *build_index(Dictionary *dict)
 {
+    HashTable *ht;
     size_t i;
 
-    TRACE(">> chain_results_free");
+    TRACE(">> build_index");
 
-    if (!results)
+    if (!dict)
     {
-        TRACE("<< chain_results_free (NULL)");
-        return;
+        TRACE("<< build_index (NULL dict)");
+        return NULL;
     }
 
-    for (i = 0; i < results->count; i++)
+    ht = hashtable_create(dict->count > 1000 ? dict->count : 1000);
+    if (!ht)
     {
-        free(results->chains[i].indices);
+        TRACE("<< build_index (create failed)");
+        return NULL;
     }
-    free(results->chains);
-    free(results);
-    GLOBAL.results = NULL;
 
-    TRACE("<< chain_results_free");
+    /* Per-length word counts ride along with the insert pass; the DFS
+     * fallback uses them to end chains whose next length is empty */
+    memset(GLOBAL.len_counts, 0, sizeof(GLOBAL.len_counts));
+    GLOBAL.max_sig_len = 0;
+
+    for (i = 0; i < dict->count; i++)
+    {
+        size_t len = strlen(dict->signatures[i]);
+
+        if (len <= POOL_MAX_WORD_LEN)
+        {
+            GLOBAL.len_counts[len]++;
+            if (len > GLOBAL.max_sig_len)
+            {
+                GLOBAL.max_sig_len = len;
+            }
+        }
+        hashtable_insert(ht, dict->signatures[i], i);
+    }
+
+    /* Count-vector probe table plus precomputed successor graph for the
+     * DFS hot path; on failure the search falls back to per-candidate
+     * probing (and ultimately to string probing via hashtable_find()) */
+    if (vec_index_build(ht) == 0)
+    {
+        adj_graph_build(dict);
+    }
+
+    /* O(1) start-word resolution; on failure the scan fallback remains */
+    word_index_build(dict);
+
+    GLOBAL.index_built = 1;
+    GLOBAL.derived_stale = 0;
+
+    TRACE("<< build_index entries=%u", (unsigned)ht->entry_count);
+
+    return ht;
 }
 
-ChainResults *find_longest_chains(HashTable *ht, Dictionary *dict,
-                                  const char *start)
+/* Word accessor for internal.c print functions */
+const char *get_word(size_t idx)
 {
-    int idx;
-    ChainResults *res = NULL;
+    if (GLOBAL.dict && idx < GLOBAL.dict->count)
+    {
+        return GLOBAL.dict->words[idx];
+    }
+    return "";
+}
 
-    TRACE(">> find_longest_chains start=%s", start ? start : "NULL");
+/*
+ * Binary snapshot format (PC only)
+ *
+ * Layout, all sections 4-byte aligned:
+ *   SnapshotHeader
+ *   word blob    - words back to back, NUL terminated
+ *   sig blob     - signatures back to back, NUL terminated
+ *   word offsets - uint32_t per word, relative to word blob
+ *   sig offsets  - uint32_t per word, relative to sig blob
+ *   entries      - per unique signature: hash (lo, hi), sig offset,
+ *                  word count, then that many uint32_t word indices
+ *
+ * Everything is offset-based, so the loader just mmaps the file, fixes up
+ * the pointer arrays and re-links entries into buckets - no signature
+ * computation, no string hashing, no deduplication.
+ */
+#if !defined(PLATFORM_ARM)
 
-    if (!ht || !dict || !start)
+#define SNAPSHOT_MAGIC   0x4e534341u /* "ACSN" */
+#define SNAPSHOT_VERSION 1u
+
+typedef struct
+{
+    uint32_t magic;
+    uint32_t version;
+    uint32_t word_count;
+    uint32_t entry_count;
+    uint32_t index_count; /* total word indices across all entries */
+    uint32_t word_blob_size;
+    uint32_t sig_blob_size;
+} SnapshotHeader;
+
+/* Pad section to 4-byte boundary */
+static int snapshot_pad(FILE *f, size_t written)
+{
+    static const char pad[4] = {0};
+    size_t rem = written % 4;
+
+    if (rem && fwrite(pad, 1, 4 - rem, f) != 4 - rem)
     {
-        TRACE("<< find_longest_chains (invalid args)");
-        return NULL;
+        return -1;
     }
+    return 0;
+}
 
-    idx = find_word_index(dict, start);
-    if (idx < 0)
+static size_t snapshot_align4(size_t n)
+{
+    return (n + 3) & ~(size_t)3;
+}
+
+int dictionary_snapshot_save(const char *fname, Dictionary *dict,
+                             HashTable *ht)
+{
+    FILE *f;
+    SnapshotHeader hdr;
+    size_t i;
+    size_t b;
+    HashEntry *entry;
+    uint32_t off;
+    uint32_t u32;
+    uint32_t *sig_cum = NULL;
+    int ok = 0;
+
+    TRACE(">> dictionary_snapshot_save fname=%s", fname ? fname : "NULL");
+
+    if (!fname || !dict || !ht)
     {
-        TRACE("<< find_longest_chains (word not found)");
-        return NULL;
+        TRACE("<< dictionary_snapshot_save (invalid args)");
+        return -1;
+    }
+
+    /* Cumulative signature offsets, indexed by word. Entry records resolve
+     * their signature offset through their first word index, which works no
+     * matter where the signature strings actually live. */
+    sig_cum = malloc(dict->count * sizeof(uint32_t));
+    if (!sig_cum)
+    {
+        TRACE("<< dictionary_snapshot_save (malloc failed)");
+        return -1;
+    }
+    off = 0;
+    for (i = 0; i < dict->count; i++)
+    {
+        sig_cum[i] = off;
+        off += (uint32_t)strlen(dict->signatures[i]) + 1;
+    }
+
+    hdr.magic = SNAPSHOT_MAGIC;
+    hdr.version = SNAPSHOT_VERSION;
+    hdr.word_count = (uint32_t)dict->count;
+    hdr.entry_count = (uint32_t)ht->entry_count;
+    hdr.index_count = 0;
+    hdr.word_blob_size = 0;
+    hdr.sig_blob_size = 0;
+
+    for (i = 0; i < dict->count; i++)
+    {
+        hdr.word_blob_size += (uint32_t)strlen(dict->words[i]) + 1;
+        hdr.sig_blob_size += (uint32_t)strlen(dict->signatures[i]) + 1;
+    }
+
+    for (b = 0; b < ht->bucket_count; b++)
+    {
+        for (entry = ht->buckets[b]; entry; entry = entry->next)
+        {
+            hdr.index_count += (uint32_t)entry->word_count;
+        }
+    }
+
+    f = fopen(fname, "wb");
+    if (!f)
+    {
+        TRACE_ERR("cannot open snapshot for writing");
+        OUTPUT("Error: Cannot write '%s'\n", fname);
+        free(sig_cum);
+        return -1;
     }
 
     do
     {
-        res = chain_results_create();
-        if (!res)
+        if (fwrite(&hdr, sizeof(hdr), 1, f) != 1)
         {
             break;
         }
 
-        /* Allocate path buffer - sized to max chain depth, not dict size */
-        GLOBAL.dfs_path_dynamic = malloc(MAX_CHAIN_DEPTH * sizeof(size_t));
-        if (!GLOBAL.dfs_path_dynamic)
+        /* Word blob */
+        for (i = 0; i < dict->count; i++)
+        {
+            if (fwrite(dict->words[i], strlen(dict->words[i]) + 1, 1, f) != 1)
+            {
+                goto write_failed;
+            }
+        }
+        if (snapshot_pad(f, hdr.word_blob_size) != 0)
         {
-            chain_results_free(res);
-            res = NULL;
             break;
         }
 
-        GLOBAL.dfs_path_dynamic[0] = (size_t)idx;
+        /* Signature blob */
+        for (i = 0; i < dict->count; i++)
+        {
+            if (fwrite(dict->signatures[i], strlen(dict->signatures[i]) + 1,
+                       1, f) != 1)
+            {
+                goto write_failed;
+            }
+        }
+        if (snapshot_pad(f, hdr.sig_blob_size) != 0)
+        {
+            break;
+        }
 
-        TRACE("   starting DFS from idx=%d", idx);
+        /* Word offsets */
+        off = 0;
+        for (i = 0; i < dict->count; i++)
+        {
+            if (fwrite(&off, sizeof(off), 1, f) != 1)
+            {
+                goto write_failed;
+            }
+            off += (uint32_t)strlen(dict->words[i]) + 1;
+        }
 
-        dfs_dynamic(ht, dict, (size_t)idx, 1);
+        /* Signature offsets */
+        if (fwrite(sig_cum, sizeof(uint32_t), dict->count, f) != dict->count)
+        {
+            break;
+        }
 
-        free(GLOBAL.dfs_path_dynamic);
-        GLOBAL.dfs_path_dynamic = NULL;
+        /* Entry records */
+        for (b = 0; b < ht->bucket_count; b++)
+        {
+            for (entry = ht->buckets[b]; entry; entry = entry->next)
+            {
+                uint64_t h64 = (uint64_t)hash_fnv1a(entry->signature);
+
+                u32 = (uint32_t)h64;
+                if (fwrite(&u32, sizeof(u32), 1, f) != 1)
+                {
+                    goto write_failed;
+                }
+                u32 = (uint32_t)(h64 >> 32);
+                if (fwrite(&u32, sizeof(u32), 1, f) != 1)
+                {
+                    goto write_failed;
+                }
+                u32 = sig_cum[entry->word_indices[0]];
+                if (fwrite(&u32, sizeof(u32), 1, f) != 1)
+                {
+                    goto write_failed;
+                }
+                u32 = (uint32_t)entry->word_count;
+                if (fwrite(&u32, sizeof(u32), 1, f) != 1)
+                {
+                    goto write_failed;
+                }
+                for (i = 0; i < entry->word_count; i++)
+                {
+                    u32 = (uint32_t)entry->word_indices[i];
+                    if (fwrite(&u32, sizeof(u32), 1, f) != 1)
+                    {
+                        goto write_failed;
+                    }
+                }
+            }
+        }
+
+        ok = 1;
     } while (0);
 
-    TRACE("<< find_longest_chains chains=%u max_len=%u",
-          res ? (unsigned)res->count : 0, res ? (unsigned)res->max_length : 0);
+write_failed:
+    fclose(f);
+    free(sig_cum);
 
-    return res;
+    if (!ok)
+    {
+        TRACE("<< dictionary_snapshot_save (write failed)");
+        return -1;
+    }
+
+    TRACE("<< dictionary_snapshot_save words=%u entries=%u",
+          (unsigned)hdr.word_count, (unsigned)hdr.entry_count);
+
+    return 0;
 }
 
-char *compute_signature(const char *word)
+HashTable *dictionary_snapshot_load(const char *fname, Dictionary *dict)
 {
-    size_t len;
+    FILE *f;
+    long fsize;
+    char *base = NULL;
+    const SnapshotHeader *hdr;
+    const char *word_blob;
+    const char *sig_blob;
+    const uint32_t *word_offs;
+    const uint32_t *sig_offs;
+    const uint32_t *p;
+    const uint32_t *q;
+    HashTable *ht = NULL;
+    HashEntry *entry;
+    unsigned long h;
+    uint64_t need;
+    uint32_t idx_left;
+    size_t cursor;
+    size_t i;
+    size_t j;
+    size_t wc;
+    char **new_words;
+    char **new_sigs;
 
-    TRACE(">> compute_signature word=%s", word ? word : "NULL");
+    TRACE(">> dictionary_snapshot_load fname=%s", fname ? fname : "NULL");
 
-    if (!word)
+    if (!fname || !dict)
     {
-        TRACE("<< compute_signature (NULL)");
+        TRACE("<< dictionary_snapshot_load (invalid args)");
         return NULL;
     }
 
-    len = strlen(word);
-    if (len >= sizeof(GLOBAL.dfs.temp_sig))
+    f = fopen(fname, "rb");
+    if (!f)
     {
-        TRACE("<< compute_signature (too long)");
+        TRACE("<< dictionary_snapshot_load (cannot open)");
         return NULL;
     }
 
-    memcpy(GLOBAL.dfs.temp_sig, word, len + 1);
-    sort_chars(GLOBAL.dfs.temp_sig, len);
-
-    TRACE("<< compute_signature result=%s", GLOBAL.dfs.temp_sig);
+    fseek(f, 0, SEEK_END);
+    fsize = ftell(f);
 
-    return GLOBAL.dfs.temp_sig;
-}
+    if (fsize < (long)sizeof(SnapshotHeader))
+    {
+        fclose(f);
+        TRACE("<< dictionary_snapshot_load (too small)");
+        return NULL;
+    }
 
-int find_word_index(Dictionary *dict, const char *word)
-{
-    size_t i;
+    base = mmap(NULL, (size_t)fsize, PROT_READ, MAP_PRIVATE, fileno(f), 0);
+    fclose(f);
+    if (base == MAP_FAILED)
+    {
+        TRACE("<< dictionary_snapshot_load (mmap failed)");
+        return NULL;
+    }
 
-    TRACE(">> find_word_index word=%s", word ? word : "NULL");
+    hdr = (const SnapshotHeader *)base;
+    if (hdr->magic != SNAPSHOT_MAGIC || hdr->version != SNAPSHOT_VERSION)
+    {
+        munmap(base, (size_t)fsize);
+        TRACE("<< dictionary_snapshot_load (not a snapshot)");
+        return NULL;
+    }
 
-    if (!word)
+    /* Validate the advertised layout against the mapped size before any
+     * offset is dereferenced: the magic alone is no guarantee (main_pc
+     * probes every input file as a snapshot), and a truncated or corrupt
+     * file must fall back to the text loader instead of faulting. */
+    need = sizeof(SnapshotHeader);
+    need += snapshot_align4(hdr->word_blob_size);
+    need += snapshot_align4(hdr->sig_blob_size);
+    need += (uint64_t)hdr->word_count * 2u * sizeof(uint32_t);
+    need += ((uint64_t)hdr->entry_count * 4u + hdr->index_count) *
+            sizeof(uint32_t);
+    if (need > (uint64_t)fsize ||
+        (hdr->word_count > 0 &&
+         (hdr->word_blob_size == 0 || hdr->sig_blob_size == 0)))
     {
-        TRACE("<< find_word_index result=-1 (NULL)");
-        return -1;
+        munmap(base, (size_t)fsize);
+        TRACE("<< dictionary_snapshot_load (truncated)");
+        return NULL;
     }
 
-    if (!dict)
+    /* Locate sections */
+    cursor = sizeof(SnapshotHeader);
+    word_blob = base + cursor;
+    cursor += snapshot_align4(hdr->word_blob_size);
+    sig_blob = base + cursor;
+    cursor += snapshot_align4(hdr->sig_blob_size);
+    word_offs = (const uint32_t *)(base + cursor);
+    cursor += hdr->word_count * sizeof(uint32_t);
+    sig_offs = (const uint32_t *)(base + cursor);
+    cursor += hdr->word_count * sizeof(uint32_t);
+    p = (const uint32_t *)(base + cursor);
+
+    /* Blobs must end in NUL and every offset must land inside its blob,
+     * so no string read can run past the mapping */
+    if ((hdr->word_blob_size > 0 &&
+         word_blob[hdr->word_blob_size - 1] != '\0') ||
+        (hdr->sig_blob_size > 0 && sig_blob[hdr->sig_blob_size - 1] != '\0'))
     {
-        dict = GLOBAL.dict;
+        munmap(base, (size_t)fsize);
+        TRACE("<< dictionary_snapshot_load (corrupt blob)");
+        return NULL;
+    }
+    for (i = 0; i < hdr->word_count; i++)
+    {
+        if (word_offs[i] >= hdr->word_blob_size ||
+            sig_offs[i] >= hdr->sig_blob_size)
+        {
+            munmap(base, (size_t)fsize);
+            TRACE("<< dictionary_snapshot_load (offset out of range)");
+            return NULL;
+        }
     }
 
-    if (dict)
+    /* Walk the entry records once before anything is built from them.
+     * The size check above caps the walk at entry_count * 4 +
+     * index_count words, so keeping each count within the remaining
+     * index budget keeps every read inside the mapping. */
+    q = p;
+    idx_left = hdr->index_count;
+    for (i = 0; i < hdr->entry_count; i++)
     {
-        for (i = 0; i < dict->count; i++)
+        if (q[3] == 0 || q[3] > idx_left || q[2] >= hdr->sig_blob_size)
         {
-            if (strcmp(dict->words[i], word) == 0)
+            munmap(base, (size_t)fsize);
+            TRACE("<< dictionary_snapshot_load (corrupt entry)");
+            return NULL;
+        }
+        for (j = 0; j < q[3]; j++)
+        {
+            if (q[4 + j] >= hdr->word_count)
             {
-                TRACE("<< find_word_index result=%u", (unsigned)i);
-                return (int)i;
+                munmap(base, (size_t)fsize);
+                TRACE("<< dictionary_snapshot_load (word index out of range)");
+                return NULL;
             }
         }
+        idx_left -= q[3];
+        q += 4 + q[3];
+    }
+
+    /* Grow pointer arrays if the snapshot is larger than the dictionary */
+    if (hdr->word_count > dict->capacity)
+    {
+        new_words = realloc(dict->words, hdr->word_count * sizeof(char *));
+        new_sigs = realloc(dict->signatures, hdr->word_count * sizeof(char *));
+        if (!new_words || !new_sigs)
+        {
+            munmap(base, (size_t)fsize);
+            TRACE("<< dictionary_snapshot_load (realloc failed)");
+            return NULL;
+        }
+        dict->words = new_words;
+        dict->signatures = new_sigs;
+        dict->capacity = hdr->word_count;
     }
 
-    TRACE("<< find_word_index result=-1 (not found)");
-
-    return -1;
-}
-
-HashTable *build_index(Dictionary *dict)
-{
-    HashTable *ht;
-    size_t i;
-
-    TRACE(">> build_index");
-
-    if (!dict)
+    /* Point words and signatures straight into the mapping */
+    for (i = 0; i < hdr->word_count; i++)
     {
-        TRACE("<< build_index (NULL dict)");
-        return NULL;
+        dict->words[i] = (char *)(word_blob + word_offs[i]);
+        dict->signatures[i] = (char *)(sig_blob + sig_offs[i]);
     }
+    dict->count = hdr->word_count;
 
+    /* Re-place index entries into slots using the stored full hashes */
     ht = hashtable_create(dict->count > 1000 ? dict->count : 1000);
     if (!ht)
     {
-        TRACE("<< build_index (create failed)");
+        munmap(base, (size_t)fsize);
+        TRACE("<< dictionary_snapshot_load (hashtable_create failed)");
         return NULL;
     }
 
-    for (i = 0; i < dict->count; i++)
+    for (i = 0; i < hdr->entry_count; i++)
     {
-        hashtable_insert(ht, dict->signatures[i], i);
+        h = (unsigned long)(((uint64_t)p[1] << 32) | p[0]);
+
+        if ((ht->entry_count + 1) * 2 > ht->bucket_count &&
+            hashtable_grow(ht) != 0)
+        {
+            break;
+        }
+
+        entry = arena_alloc(sizeof(HashEntry));
+        if (!entry)
+        {
+            break;
+        }
+
+        entry->signature = (char *)(sig_blob + p[2]);
+        wc = p[3];
+        entry->word_indices = arena_alloc(wc * sizeof(size_t));
+        if (!entry->word_indices)
+        {
+            break;
+        }
+        for (j = 0; j < wc; j++)
+        {
+            entry->word_indices[j] = p[4 + j];
+        }
+        entry->word_count = wc;
+        entry->word_capacity = wc;
+        entry->next = NULL;
+        hashtable_place(ht, entry, h);
+        ht->entry_count++;
+
+        p += 4 + wc;
     }
 
-    TRACE("<< build_index entries=%u", (unsigned)ht->entry_count);
+    dictionary_set_mapping(base, (size_t)fsize);
+
+    if (vec_index_build(ht) == 0)
+    {
+        adj_graph_build(dict);
+    }
+    word_index_build(dict);
+
+    GLOBAL.index_built = 1;
+    GLOBAL.derived_stale = 0;
+
+    TRACE("<< dictionary_snapshot_load words=%u entries=%u",
+          (unsigned)dict->count, (unsigned)ht->entry_count);
 
     return ht;
 }
 
-/* Word accessor for internal.c print functions */
-const char *get_word(size_t idx)
+#else /* PLATFORM_ARM */
+
+int dictionary_snapshot_save(const char *fname, Dictionary *dict,
+                             HashTable *ht)
 {
-    if (GLOBAL.dict && idx < GLOBAL.dict->count)
-    {
-        return GLOBAL.dict->words[idx];
-    }
-    return "";
+    UNUSED(fname);
+    UNUSED(dict);
+    UNUSED(ht);
+
+    TRACE_ERR("snapshots not supported on ARM");
+
+    return -1;
+}
+
+HashTable *dictionary_snapshot_load(const char *fname, Dictionary *dict)
+{
+    UNUSED(fname);
+    UNUSED(dict);
+
+    TRACE_ERR("snapshots not supported on ARM");
+
+    return NULL;
 }
 
+#endif /* !PLATFORM_ARM */
+
 #else /* Static memory mode */
 
+/* ARM_RODICT: the dictionary and its index were generated at build time
+ * (gen_rodict.py) and live in flash; the SRAM pools below are compiled
+ * out and lookups go to the const tables instead. */
+#if defined(ARM_RODICT)
+#include "rodict.h"
+#endif
+
+#if !defined(ARM_RODICT)
 typedef struct
 {
     WordBuffer signature;
-    size_t word_indices[POOL_MAX_INDICES_PER_ENTRY];
-    size_t word_count;
-    int next_idx; /* -1 = end of chain */
+    size_t index_offset;  /* First posting in GLOBAL.index_slab */
+    size_t word_count;    /* Postings in use */
+    size_t word_capacity; /* Slab run currently reserved */
+    int next_idx;         /* -1 = end of chain */
     int used;
 } StaticHashEntry;
+#endif
 
 /* Static chain storage with metadata */
 typedef struct
@@ -845,44 +3109,126 @@ typedef struct
     int current_idx;
 } SigBufferPool;
 
+/* One level of the explicit DFS stack: the word being expanded plus the
+ * candidate-character and entry-word cursors needed to resume it. The
+ * frame array replaces C recursion, so worst-case search stack usage is
+ * a compile-time constant - important for the small FreeRTOS task stack */
+typedef struct
+{
+    size_t cur;     /* Word index at this level */
+    size_t sig_len; /* Length of its signature */
+    int c;          /* Next candidate character to derive */
+    int entry_idx;  /* Matched hash entry being expanded, -1 = none */
+    size_t word_i;  /* Next word inside that entry */
+    int found;      /* A successor existed at this level */
+} DfsFrame;
+
 typedef struct
 {
+    size_t word_count;
+
+#if !defined(ARM_RODICT)
     /* Word and signature storage - combined into entries */
     WordEntry entries[POOL_MAX_WORDS];
-    size_t word_count;
 
     /* Pointer arrays for API compatibility with dynamic mode */
     char *word_ptrs[POOL_MAX_WORDS];
     char *sig_ptrs[POOL_MAX_WORDS];
+#endif
 
     /* Dictionary structure */
     Dictionary dictionary;
     int dict_initialized;
 
+#if !defined(ARM_RODICT)
     /* Hash table */
     StaticHashEntry hash_entries[POOL_MAX_HASH_ENTRIES];
     int hash_buckets[POOL_HASH_BUCKETS];
     size_t hash_entry_count;
 
+    /* Shared posting-list slab: entries hold variable-length runs of
+     * word indices here instead of a fixed-size per-entry array, so the
+     * footprint tracks the dictionary rather than the worst case and no
+     * signature's word list is ever truncated. See slab_reserve(). */
+    size_t index_slab[POOL_INDEX_SLAB_SIZE];
+    size_t index_slab_used;
+
+    /* One occupancy bit per bucket: 1/32nd of the bucket array, so the
+     * common miss - a candidate signature that does not exist - is
+     * rejected by a cache-resident bit test before the bucket walk */
+    uint32_t bucket_bits[(POOL_HASH_BUCKETS + 31) / 32];
+
+    /* Length-partitioned bucket layout: the bucket array is carved into
+     * one contiguous region per signature length, sized proportionally
+     * to the words of that length, so a probe from a length-k node only
+     * touches the (k+1)-length partition. Built by build_index(). */
+    size_t len_part_offset[POOL_MAX_WORD_LEN + 1];
+    size_t len_part_size[POOL_MAX_WORD_LEN + 1];
+#endif
+
+    size_t len_word_counts[POOL_MAX_WORD_LEN + 1];
+    size_t max_sig_len; /* Longest populated length = depth upper bound */
+    int len_parts_built;
+
+#if !defined(ARM_RODICT)
     /* Wrappers to provide API-compatible HashEntry pointers */
     HashEntry hash_entry_wrappers[POOL_MAX_HASH_ENTRIES];
+#endif
 
     HashTable hashtable;
     int ht_initialized;
 
+#if !defined(ARM_RODICT)
+    /* Word-keyed lookup index: slot stores word index + 1, 0 = empty.
+     * Built in build_index(); words added later are found by tail scan. */
+    uint32_t word_slots[WORD_INDEX_SLOTS];
+    size_t word_indexed;
+#endif
+
     /* Chain storage */
     StaticChains chains;
 
     /* DFS working buffers */
     DfsContext dfs;
 
+    /* Explicit DFS stack - one frame per chain word, see dfs_static() */
+    DfsFrame dfs_frames[MAX_CHAIN_DEPTH];
+
     /* Rotating signature buffers for compute_signature */
     SigBufferPool sig_buffers;
 } GlobalState;
 
+#if defined(PLATFORM_ARM)
+
 static GlobalState G = {0};
 #define GLOBAL G
 
+#else
+
+/* PC: reserve the state with one anonymous MAP_NORESERVE mapping instead
+ * of a giant BSS object. Pages are committed on first touch, so resident
+ * memory and overcommit accounting track the dictionary actually loaded
+ * rather than the compile-time pool limits, while static mode's
+ * no-malloc guarantee is kept: one fixed reservation before main(), no
+ * allocator in any hot path. */
+static GlobalState *g_state;
+
+__attribute__((constructor)) static void global_state_map(void)
+{
+    g_state = mmap(NULL, sizeof(GlobalState), PROT_READ | PROT_WRITE,
+                   MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+    if (g_state == MAP_FAILED)
+    {
+        fprintf(stderr, "Failed to reserve static pools (%zu bytes)\n",
+                sizeof(GlobalState));
+        exit(1);
+    }
+}
+
+#define GLOBAL (*g_state)
+
+#endif /* PLATFORM_ARM */
+
 /* Reset all static pools - only reset control variables, not data arrays */
 static void reset_all(void)
 {
@@ -890,86 +3236,346 @@ static void reset_all(void)
     GLOBAL.dict_initialized = 0;
     GLOBAL.ht_initialized = 0;
     GLOBAL.chains.initialized = 0;
-    GLOBAL.hash_entry_count = 0;
     GLOBAL.sig_buffers.current_idx = 0;
+    GLOBAL.len_parts_built = 0;
+    GLOBAL.max_sig_len = 0;
+
+#if !defined(ARM_RODICT)
+    GLOBAL.hash_entry_count = 0;
+    GLOBAL.word_indexed = 0;
+    GLOBAL.index_slab_used = 0;
 
     memset(GLOBAL.hash_buckets, 0xFF, sizeof(GLOBAL.hash_buckets));
+    memset(GLOBAL.bucket_bits, 0, sizeof(GLOBAL.bucket_bits));
+#endif
 }
 
-/* DFS search - no visited array, chains always increase in length */
-static void dfs_static(size_t cur, size_t depth)
+#if !defined(ARM_RODICT)
+/* Bucket for a signature of the given length: its length's partition once
+ * build_index() has carved one, the whole array otherwise. Insert and
+ * find always agree because the partition table only changes together
+ * with a full rebuild of the bucket array. */
+static size_t sig_bucket(const char *sig, size_t len)
 {
-    const char *sig;
-    size_t sig_len;
-    int found;
-    int c;
     unsigned long h;
+
+    h = hash_fnv1a(sig);
+
+    if (GLOBAL.len_parts_built && len <= POOL_MAX_WORD_LEN &&
+        GLOBAL.len_part_size[len])
+    {
+        return GLOBAL.len_part_offset[len] +
+               (size_t)(h % GLOBAL.len_part_size[len]);
+    }
+
+    return (size_t)(h % POOL_HASH_BUCKETS);
+}
+#endif /* !ARM_RODICT */
+
+/* ============================================================================
+ * Dictionary storage seam
+ * ============================================================================
+ * All word/signature reads and candidate probes go through these
+ * helpers, so the rest of the search code is identical whether the
+ * dictionary lives in the SRAM pools or in the flash rodict tables.
+ */
+
+#if defined(ARM_RODICT)
+
+/* 32-bit FNV-1a with explicit wrapping; must match gen_rodict.py,
+ * unlike hash_fnv1a() whose width follows the platform's long */
+static uint32_t rodict_hash32(const char *s)
+{
+    uint32_t h = 2166136261u;
+
+    while (*s)
+    {
+        h ^= (unsigned char)*s++;
+        h *= 16777619u;
+    }
+
+    return h;
+}
+
+static const char *entry_word(size_t idx)
+{
+    return g_rodict_words[idx];
+}
+
+static const char *entry_sig(size_t idx)
+{
+    return g_rodict_sigs[idx];
+}
+
+/* Entry index for a signature, -1 if absent: one bitmap test rejects
+ * most non-existent candidates, the rest binary-search the sorted
+ * flash entry table */
+static int probe_signature(const char *sig, size_t len)
+{
+    uint32_t bit;
+    size_t lo;
+    size_t hi;
+
+    UNUSED(len);
+
+    bit = rodict_hash32(sig) % (uint32_t)(g_rodict_sig_bits_words * 32);
+    if (!(g_rodict_sig_bits[bit / 32] & (1u << (bit % 32))))
+    {
+        return -1;
+    }
+
+    lo = 0;
+    hi = g_rodict_entry_count;
+    while (lo < hi)
+    {
+        size_t mid = lo + (hi - lo) / 2;
+        int cmp = strcmp(g_rodict_entries[mid].signature, sig);
+
+        if (cmp == 0)
+        {
+            return (int)mid;
+        }
+        if (cmp < 0)
+        {
+            lo = mid + 1;
+        }
+        else
+        {
+            hi = mid;
+        }
+    }
+
+    return -1;
+}
+
+static size_t probe_entry_words(int entry_idx)
+{
+    return g_rodict_entries[entry_idx].word_count;
+}
+
+static size_t probe_entry_word_at(int entry_idx, size_t i)
+{
+    return g_rodict_indices[g_rodict_entries[entry_idx].index_offset + i];
+}
+
+#else /* !ARM_RODICT */
+
+static const char *entry_word(size_t idx)
+{
+    return GLOBAL.entries[idx].word;
+}
+
+static const char *entry_sig(size_t idx)
+{
+    return GLOBAL.entries[idx].signature;
+}
+
+/* Entry index for a signature, -1 if absent: one occupancy bit test
+ * rejects most non-existent candidates before the bucket walk */
+static int probe_signature(const char *sig, size_t len)
+{
+    size_t h;
     int idx;
-    StaticHashEntry *e;
+
+    h = sig_bucket(sig, len);
+    if (!(GLOBAL.bucket_bits[h / 32] & (1u << (h % 32))))
+    {
+        return -1;
+    }
+
+    idx = GLOBAL.hash_buckets[h];
+    while (idx >= 0)
+    {
+        if (strcmp(GLOBAL.hash_entries[idx].signature, sig) == 0)
+        {
+            break;
+        }
+        idx = GLOBAL.hash_entries[idx].next_idx;
+    }
+
+    return idx;
+}
+
+static size_t probe_entry_words(int entry_idx)
+{
+    return GLOBAL.hash_entries[entry_idx].word_count;
+}
+
+static size_t probe_entry_word_at(int entry_idx, size_t i)
+{
+    return GLOBAL.index_slab[GLOBAL.hash_entries[entry_idx].index_offset + i];
+}
+
+#endif /* ARM_RODICT */
+
+/* Streaming mode for dfs_static(): while a callback is set, maximal
+ * chains go to it instead of the shared result set and the bound-based
+ * pruning is disabled, so every maximal chain is reported */
+static ChainStreamFn g_stream_cb;
+static void *g_stream_user;
+static size_t g_stream_count;
+
+/* Record a completed chain if it ties or beats the longest so far */
+static void dfs_record_chain(size_t depth)
+{
     size_t i;
-    size_t next;
     size_t chain_idx;
 
+    TRACE_EVENT(TRACE_EV_DFS_LEAF, depth);
+
+    if (depth > GLOBAL.chains.results.max_length)
+    {
+        GLOBAL.chains.results.count = 0;
+        GLOBAL.chains.results.max_length = depth;
+    }
+
+    if (depth == GLOBAL.chains.results.max_length &&
+        GLOBAL.chains.results.count < POOL_MAX_CHAINS)
+    {
+        chain_idx = GLOBAL.chains.results.count;
+        for (i = 0; i < depth && i < POOL_MAX_CHAIN_LEN; i++)
+        {
+            GLOBAL.chains.storage[chain_idx].indices[i] = GLOBAL.dfs.path[i];
+        }
+        GLOBAL.chains.storage[chain_idx].length = depth;
+        GLOBAL.chains.api_chains[chain_idx].indices =
+            GLOBAL.chains.storage[chain_idx].indices;
+        GLOBAL.chains.api_chains[chain_idx].length = depth;
+        GLOBAL.chains.results.count++;
+    }
+}
+
+/* Set up a stack frame for one word before it is first stepped */
+static void dfs_frame_init(DfsFrame *f, size_t cur)
+{
+    PERF_COUNT(dfs_nodes);
+
+    f->cur = cur;
+    f->sig_len = strlen(entry_sig(cur));
+    f->entry_idx = -1;
+    f->word_i = 0;
+    f->found = 0;
+
+    /* With the length counts from build_index() an empty next length
+     * ends the chain without probing a single candidate */
+    if (GLOBAL.len_parts_built &&
+        (f->sig_len >= GLOBAL.max_sig_len ||
+         GLOBAL.len_word_counts[f->sig_len + 1] == 0))
+    {
+        f->c = ASCII_MAX + 1;
+    }
+    else
+    {
+        f->c = ASCII_MIN;
+    }
+}
+
+/* Branch and bound: each further chain word is one character longer, so
+ * a node can add at most max_sig_len - sig_len words. If even that
+ * cannot tie the longest chain found so far, the branch is hopeless. */
+static int dfs_prune(size_t depth, size_t sig_len)
+{
+    if (g_stream_cb || !GLOBAL.len_parts_built ||
+        sig_len > GLOBAL.max_sig_len)
+    {
+        return 0;
+    }
+
+    return depth + (GLOBAL.max_sig_len - sig_len) <
+           GLOBAL.chains.results.max_length;
+}
+
+/* DFS search - no visited array, chains always increase in length.
+ * Runs as an explicit stack machine over GLOBAL.dfs_frames: each level
+ * resumes from its saved candidate and entry cursors, so there is no C
+ * recursion and stack usage no longer grows with chain depth. */
+static void dfs_static(size_t cur, size_t depth)
+{
+    DfsFrame *f;
+    int idx;
+    size_t next;
+    int sp;
+
     ASSERT_MSG(cur < POOL_MAX_WORDS, "cur index out of bounds");
     ASSERT_MSG(depth <= MAX_CHAIN_DEPTH, "depth exceeds MAX_CHAIN_DEPTH");
 
-    sig = GLOBAL.entries[cur].signature;
-    sig_len = strlen(sig);
-    found = 0;
-
     if (depth >= MAX_CHAIN_DEPTH)
     {
         return;
     }
 
-    for (c = ASCII_MIN; c <= ASCII_MAX; c++)
+    sp = 0;
+    dfs_frame_init(&GLOBAL.dfs_frames[0], cur);
+    if (dfs_prune(depth, GLOBAL.dfs_frames[0].sig_len))
     {
-        insert_sorted(GLOBAL.dfs.candidate, sig, sig_len, (char)c);
+        return;
+    }
 
-        h = hash_fnv1a(GLOBAL.dfs.candidate) % POOL_HASH_BUCKETS;
-        idx = GLOBAL.hash_buckets[h];
+    while (sp >= 0)
+    {
+        f = &GLOBAL.dfs_frames[sp];
 
-        while (idx >= 0)
+        if (f->entry_idx >= 0)
         {
-            e = &GLOBAL.hash_entries[idx];
-            if (strcmp(e->signature, GLOBAL.dfs.candidate) == 0)
+            /* Expanding a matched entry: descend into its next word */
+            if (f->word_i < probe_entry_words(f->entry_idx))
             {
-                for (i = 0; i < e->word_count; i++)
+                next = probe_entry_word_at(f->entry_idx, f->word_i++);
+                f->found = 1;
+                GLOBAL.dfs.path[depth + sp] = next;
+
+                if (depth + sp + 1 < MAX_CHAIN_DEPTH &&
+                    !dfs_prune(depth + sp + 1, f->sig_len + 1))
                 {
-                    next = e->word_indices[i];
-                    found = 1;
-                    GLOBAL.dfs.path[depth] = next;
-                    dfs_static(next, depth + 1);
+                    sp++;
+                    dfs_frame_init(&GLOBAL.dfs_frames[sp], next);
                 }
-                break;
+                continue;
             }
-            idx = e->next_idx;
+
+            /* Entry exhausted - move to the next candidate character */
+            f->entry_idx = -1;
+            f->c++;
+            continue;
         }
-    }
 
-    if (!found)
-    {
-        if (depth > GLOBAL.chains.results.max_length)
+        if (f->c <= ASCII_MAX)
         {
-            GLOBAL.chains.results.count = 0;
-            GLOBAL.chains.results.max_length = depth;
+            insert_sorted(GLOBAL.dfs.candidate, entry_sig(f->cur),
+                          f->sig_len, (char)f->c);
+
+            idx = probe_signature(GLOBAL.dfs.candidate, f->sig_len + 1);
+            if (idx >= 0)
+            {
+                PERF_COUNT(probe_hits);
+                f->entry_idx = idx;
+                f->word_i = 0;
+            }
+            else
+            {
+                PERF_COUNT(probe_misses);
+                f->c++;
+            }
+            continue;
         }
 
-        if (depth == GLOBAL.chains.results.max_length &&
-            GLOBAL.chains.results.count < POOL_MAX_CHAINS)
+        /* All candidates tried: a node without successors ends a chain */
+        if (!f->found)
         {
-            chain_idx = GLOBAL.chains.results.count;
-            for (i = 0; i < depth && i < POOL_MAX_CHAIN_LEN; i++)
+            if (g_stream_cb)
+            {
+                g_stream_count++;
+                if (g_stream_cb(GLOBAL.dfs.path, depth + sp, g_stream_user))
+                {
+                    break;
+                }
+            }
+            else
             {
-                GLOBAL.chains.storage[chain_idx].indices[i] =
-                    GLOBAL.dfs.path[i];
+                dfs_record_chain(depth + sp);
             }
-            GLOBAL.chains.storage[chain_idx].length = depth;
-            GLOBAL.chains.api_chains[chain_idx].indices =
-                GLOBAL.chains.storage[chain_idx].indices;
-            GLOBAL.chains.api_chains[chain_idx].length = depth;
-            GLOBAL.chains.results.count++;
         }
+        sp--;
     }
 }
 
@@ -984,6 +3590,18 @@ Dictionary *dictionary_create(size_t cap)
     if (!GLOBAL.dict_initialized)
     {
         reset_all();
+#if defined(ARM_RODICT)
+        /* The dictionary was generated at build time and lives in
+         * flash; the API exposes it through the usual pointer arrays.
+         * Casting away const is confined to this wiring - every write
+         * path below rejects the read-only dictionary. */
+        UNUSED(i);
+        GLOBAL.word_count = g_rodict_word_count;
+        GLOBAL.dictionary.words = (char **)g_rodict_words;
+        GLOBAL.dictionary.signatures = (char **)g_rodict_sigs;
+        GLOBAL.dictionary.count = g_rodict_word_count;
+        GLOBAL.dictionary.capacity = g_rodict_word_count;
+#else
         for (i = 0; i < POOL_MAX_WORDS; i++)
         {
             GLOBAL.word_ptrs[i] = GLOBAL.entries[i].word;
@@ -993,6 +3611,7 @@ Dictionary *dictionary_create(size_t cap)
         GLOBAL.dictionary.signatures = GLOBAL.sig_ptrs;
         GLOBAL.dictionary.count = 0;
         GLOBAL.dictionary.capacity = POOL_MAX_WORDS;
+#endif
         GLOBAL.dict_initialized = 1;
     }
 
@@ -1010,12 +3629,23 @@ void dictionary_free(Dictionary *dict)
     GLOBAL.word_count = 0;
     GLOBAL.dictionary.count = 0;
     GLOBAL.dict_initialized = 0;
+#if !defined(ARM_RODICT)
+    GLOBAL.word_indexed = 0;
+#endif
 
     TRACE("<< dictionary_free");
 }
 
 int dictionary_add(Dictionary *dict, const char *word)
 {
+#if defined(ARM_RODICT)
+    UNUSED(dict);
+    UNUSED(word);
+
+    TRACE_ERR("dictionary is read-only (ARM_RODICT)");
+
+    return -1;
+#else
     size_t len;
 
     TRACE(">> dictionary_add word=%s", word ? word : "NULL");
@@ -1042,9 +3672,39 @@ int dictionary_add(Dictionary *dict, const char *word)
     GLOBAL.word_count++;
     GLOBAL.dictionary.count = GLOBAL.word_count;
 
-    TRACE("<< dictionary_add count=%u", (unsigned)GLOBAL.word_count);
+    /* Incremental index maintenance: once build_index() has run, new
+     * words go straight into the signature table and length counts.
+     * A previously empty length keeps no partition, so sig_bucket()
+     * routes it through the global modulo for insert and find alike.
+     * find_word_index() covers the new word via its tail scan. */
+    if (GLOBAL.len_parts_built)
+    {
+        size_t sig_len;
+
+        hashtable_insert(&GLOBAL.hashtable,
+                         GLOBAL.entries[GLOBAL.word_count - 1].signature,
+                         GLOBAL.word_count - 1);
+
+        sig_len = strlen(GLOBAL.entries[GLOBAL.word_count - 1].signature);
+        GLOBAL.len_word_counts[sig_len]++;
+        if (sig_len > GLOBAL.max_sig_len)
+        {
+            GLOBAL.max_sig_len = sig_len;
+        }
+    }
+
+    TRACE("<< dictionary_add count=%u", (unsigned)GLOBAL.word_count);
+
+    return 0;
+#endif /* ARM_RODICT */
+}
+
+/* Static mode has no external storage to reference - always copies */
+int dictionary_add_ref(Dictionary *dict, char *word, size_t len)
+{
+    UNUSED(len);
 
-    return 0;
+    return dictionary_add(dict, word);
 }
 
 HashTable *hashtable_create(size_t bucket_count)
@@ -1053,9 +3713,15 @@ HashTable *hashtable_create(size_t bucket_count)
 
     UNUSED(bucket_count);
 
+#if !defined(ARM_RODICT)
     memset(GLOBAL.hash_buckets, 0xFF, sizeof(GLOBAL.hash_buckets));
-
+    memset(GLOBAL.bucket_bits, 0, sizeof(GLOBAL.bucket_bits));
     GLOBAL.hash_entry_count = 0;
+#endif
+
+    /* A fresh table starts unpartitioned; build_index() re-enables the
+     * per-length layout after recomputing it for the current words */
+    GLOBAL.len_parts_built = 0;
     GLOBAL.hashtable.buckets = NULL;
     GLOBAL.hashtable.bucket_count = POOL_HASH_BUCKETS;
     GLOBAL.hashtable.entry_count = 0;
@@ -1072,16 +3738,67 @@ void hashtable_free(HashTable *ht)
 
     UNUSED(ht);
 
+#if !defined(ARM_RODICT)
     GLOBAL.hash_entry_count = 0;
+#endif
     GLOBAL.hashtable.entry_count = 0;
     GLOBAL.ht_initialized = 0;
 
     TRACE("<< hashtable_free");
 }
 
+#if !defined(ARM_RODICT)
+/* Make room for one more posting in an entry's slab run. Runs double in
+ * place while they are the newest allocation; otherwise they move to a
+ * fresh run at the slab tail, stranding the old one (the 4x slab sizing
+ * bounds that waste). Returns 0 on success, -1 when the slab is full. */
+static int slab_reserve(StaticHashEntry *e)
+{
+    size_t new_cap;
+
+    if (e->word_count < e->word_capacity)
+    {
+        return 0;
+    }
+
+    new_cap = e->word_capacity * 2;
+
+    if (e->index_offset + e->word_capacity == GLOBAL.index_slab_used &&
+        e->index_offset + new_cap <= POOL_INDEX_SLAB_SIZE)
+    {
+        /* Newest run: extend in place */
+        GLOBAL.index_slab_used = e->index_offset + new_cap;
+        e->word_capacity = new_cap;
+        return 0;
+    }
+
+    if (GLOBAL.index_slab_used + new_cap > POOL_INDEX_SLAB_SIZE)
+    {
+        return -1;
+    }
+
+    memcpy(&GLOBAL.index_slab[GLOBAL.index_slab_used],
+           &GLOBAL.index_slab[e->index_offset],
+           e->word_count * sizeof(size_t));
+    e->index_offset = GLOBAL.index_slab_used;
+    e->word_capacity = new_cap;
+    GLOBAL.index_slab_used += new_cap;
+
+    return 0;
+}
+
+#endif /* !ARM_RODICT */
+
 void hashtable_insert(HashTable *ht, const char *sig, size_t word_idx)
 {
-    unsigned long h;
+#if defined(ARM_RODICT)
+    UNUSED(ht);
+    UNUSED(sig);
+    UNUSED(word_idx);
+
+    TRACE_ERR("index is read-only (ARM_RODICT)");
+#else
+    size_t h;
     int idx;
     StaticHashEntry *e;
     size_t new_idx;
@@ -1098,7 +3815,10 @@ void hashtable_insert(HashTable *ht, const char *sig, size_t word_idx)
         return;
     }
 
-    h = hash_fnv1a(sig) % POOL_HASH_BUCKETS;
+    sig_len = strlen(sig);
+    h = sig_bucket(sig, sig_len);
+    TRACE_EVENT(TRACE_EV_HT_INSERT, word_idx);
+    PERF_COUNT(ht_inserts);
 
     idx = GLOBAL.hash_buckets[h];
     while (idx >= 0)
@@ -1106,10 +3826,13 @@ void hashtable_insert(HashTable *ht, const char *sig, size_t word_idx)
         e = &GLOBAL.hash_entries[idx];
         if (strcmp(e->signature, sig) == 0)
         {
-            if (e->word_count < POOL_MAX_INDICES_PER_ENTRY)
+            if (slab_reserve(e) != 0)
             {
-                e->word_indices[e->word_count++] = word_idx;
+                TRACE("<< hashtable_insert (slab full)");
+                return;
             }
+            GLOBAL.index_slab[e->index_offset + e->word_count] = word_idx;
+            e->word_count++;
 
             TRACE("<< hashtable_insert (existing)");
             return;
@@ -1117,7 +3840,8 @@ void hashtable_insert(HashTable *ht, const char *sig, size_t word_idx)
         idx = e->next_idx;
     }
 
-    if (GLOBAL.hash_entry_count >= POOL_MAX_HASH_ENTRIES)
+    if (GLOBAL.hash_entry_count >= POOL_MAX_HASH_ENTRIES ||
+        GLOBAL.index_slab_used + 2 > POOL_INDEX_SLAB_SIZE)
     {
         TRACE("<< hashtable_insert (pool full)");
         return;
@@ -1125,26 +3849,69 @@ void hashtable_insert(HashTable *ht, const char *sig, size_t word_idx)
 
     new_idx = GLOBAL.hash_entry_count++;
     e = &GLOBAL.hash_entries[new_idx];
-    sig_len = strlen(sig);
 
     if (sig_len < POOL_MAX_WORD_LEN)
     {
         memcpy(e->signature, sig, sig_len + 1);
     }
 
-    e->word_indices[0] = word_idx;
+    /* Start each run small - most signatures map to only a word or two */
+    e->index_offset = GLOBAL.index_slab_used;
+    e->word_capacity = 2;
+    GLOBAL.index_slab_used += 2;
+    GLOBAL.index_slab[e->index_offset] = word_idx;
     e->word_count = 1;
     e->next_idx = GLOBAL.hash_buckets[h];
     e->used = 1;
     GLOBAL.hash_buckets[h] = (int)new_idx;
+    GLOBAL.bucket_bits[h / 32] |= 1u << (h % 32);
     GLOBAL.hashtable.entry_count = GLOBAL.hash_entry_count;
 
     TRACE("<< hashtable_insert (new)");
+#endif /* ARM_RODICT */
 }
 
+#if defined(ARM_RODICT)
+
 HashEntry *hashtable_find(HashTable *ht, const char *sig)
 {
-    unsigned long h;
+    /* Scratch wrapper: valid until the next find, like the dynamic
+     * mode's per-entry wrappers are valid until the next rebuild */
+    static HashEntry wrapper;
+    const RoDictEntry *re;
+    int idx;
+
+    UNUSED(ht);
+
+    if (!sig)
+    {
+        return NULL;
+    }
+
+    TRACE_EVENT(TRACE_EV_HT_FIND, 0);
+    PERF_COUNT(ht_finds);
+
+    idx = probe_signature(sig, strlen(sig));
+    if (idx < 0)
+    {
+        return NULL;
+    }
+
+    re = &g_rodict_entries[idx];
+    wrapper.signature = (char *)re->signature;
+    wrapper.word_indices = (size_t *)&g_rodict_indices[re->index_offset];
+    wrapper.word_count = re->word_count;
+    wrapper.word_capacity = re->word_count;
+    wrapper.next = NULL;
+
+    return &wrapper;
+}
+
+#else /* !ARM_RODICT */
+
+HashEntry *hashtable_find(HashTable *ht, const char *sig)
+{
+    size_t h;
     int idx;
     StaticHashEntry *se;
     HashEntry *e;
@@ -1156,20 +3923,31 @@ HashEntry *hashtable_find(HashTable *ht, const char *sig)
         return NULL;
     }
 
-    h = hash_fnv1a(sig) % POOL_HASH_BUCKETS;
+    h = sig_bucket(sig, strlen(sig));
+    TRACE_EVENT(TRACE_EV_HT_FIND, h);
+    PERF_COUNT(ht_finds);
+
+    /* Cache-resident prefilter: empty bucket means a definite miss
+     * without touching the bucket array at all */
+    if (!(GLOBAL.bucket_bits[h / 32] & (1u << (h % 32))))
+    {
+        return NULL;
+    }
+
     idx = GLOBAL.hash_buckets[h];
 
     while (idx >= 0)
     {
+        PERF_COUNT(ht_steps);
         se = &GLOBAL.hash_entries[idx];
         if (strcmp(se->signature, sig) == 0)
         {
             /* Return wrapper with pointers to static data */
             e = &GLOBAL.hash_entry_wrappers[idx];
             e->signature = se->signature;
-            e->word_indices = se->word_indices;
+            e->word_indices = &GLOBAL.index_slab[se->index_offset];
             e->word_count = se->word_count;
-            e->word_capacity = POOL_MAX_INDICES_PER_ENTRY;
+            e->word_capacity = se->word_capacity;
             e->next = NULL;
             return e;
         }
@@ -1179,6 +3957,26 @@ HashEntry *hashtable_find(HashTable *ht, const char *sig)
     return NULL;
 }
 
+#endif /* ARM_RODICT */
+
+void perf_stats_get(PerfStats *out)
+{
+    if (!out)
+    {
+        return;
+    }
+
+    *out = g_perf_stats;
+#if defined(ARM_RODICT)
+    /* Dictionary and index live in flash - no SRAM pool usage */
+    out->pool_word_bytes = 0;
+    out->pool_sig_bytes = 0;
+#else
+    out->pool_word_bytes = GLOBAL.word_count * sizeof(WordEntry);
+    out->pool_sig_bytes = GLOBAL.hash_entry_count * sizeof(StaticHashEntry);
+#endif
+}
+
 ChainResults *chain_results_create(void)
 {
     TRACE(">> chain_results_create");
@@ -1258,6 +4056,126 @@ ChainResults *find_longest_chains(HashTable *ht, Dictionary *dict,
     return res;
 }
 
+int find_chains_stream(HashTable *ht, Dictionary *dict, const char *start,
+                       ChainStreamFn callback, void *user)
+{
+    int idx;
+    int delivered;
+
+    TRACE(">> find_chains_stream start=%s", start ? start : "NULL");
+
+    UNUSED(ht);
+    UNUSED(dict);
+
+    if (!start || !callback)
+    {
+        TRACE("<< find_chains_stream (invalid args)");
+        return -1;
+    }
+
+    idx = find_word_index(NULL, start);
+    if (idx < 0)
+    {
+        TRACE("<< find_chains_stream (word not found)");
+        return -1;
+    }
+
+    g_stream_cb = callback;
+    g_stream_user = user;
+    g_stream_count = 0;
+
+    GLOBAL.dfs.path[0] = (size_t)idx;
+    dfs_static((size_t)idx, 1);
+
+    delivered = (int)g_stream_count;
+    g_stream_cb = NULL;
+
+    TRACE("<< find_chains_stream delivered=%d", delivered);
+
+    return delivered;
+}
+
+/* A signature is a chain root if removing any one character never yields
+ * a signature present in the index - nothing can precede it in a chain */
+static int sig_is_root(HashTable *ht, const char *sig)
+{
+    size_t len = strlen(sig);
+    size_t i;
+    size_t j;
+    size_t k;
+    char prev;
+
+    if (len <= 1)
+    {
+        return 1;
+    }
+
+    prev = '\0';
+    for (i = 0; i < len; i++)
+    {
+        if (sig[i] == prev)
+        {
+            /* Removing either duplicate yields the same candidate */
+            continue;
+        }
+        prev = sig[i];
+
+        k = 0;
+        for (j = 0; j < len; j++)
+        {
+            if (j != i)
+            {
+                GLOBAL.dfs.candidate[k++] = sig[j];
+            }
+        }
+        GLOBAL.dfs.candidate[k] = '\0';
+
+        if (hashtable_find(ht, GLOBAL.dfs.candidate))
+        {
+            return 0;
+        }
+    }
+
+    return 1;
+}
+
+ChainResults *find_longest_chains_all(HashTable *ht, Dictionary *dict)
+{
+    ChainResults *res;
+    size_t i;
+
+    TRACE(">> find_longest_chains_all");
+
+    UNUSED(dict);
+
+    if (!ht)
+    {
+        TRACE("<< find_longest_chains_all (NULL ht)");
+        return NULL;
+    }
+
+    res = chain_results_create();
+    res->count = 0;
+    res->max_length = 0;
+
+    /* Search from every chain root; dfs_static shares the result set and
+     * discards shorter chains as longer ones are found */
+    for (i = 0; i < GLOBAL.word_count; i++)
+    {
+        if (!sig_is_root(ht, entry_sig(i)))
+        {
+            continue;
+        }
+        GLOBAL.dfs.path[0] = i;
+        dfs_static(i, 1);
+    }
+
+    TRACE("<< find_longest_chains_all chains=%u max_len=%u",
+          (unsigned)res->count, (unsigned)res->max_length);
+
+    return res;
+}
+
 char *compute_signature(const char *word)
 {
     size_t len;
@@ -1289,9 +4207,59 @@ char *compute_signature(const char *word)
     return buf;
 }
 
+#if defined(ARM_RODICT)
+
+int find_word_index(Dictionary *dict, const char *word)
+{
+    size_t lo;
+    size_t hi;
+
+    TRACE(">> find_word_index word=%s", word ? word : "NULL");
+
+    UNUSED(dict);
+
+    if (!word)
+    {
+        TRACE("<< find_word_index result=-1 (NULL)");
+        return -1;
+    }
+
+    /* Binary search the generated word-order table; no SRAM slot index
+     * is needed for a dictionary that cannot change */
+    lo = 0;
+    hi = g_rodict_word_count;
+    while (lo < hi)
+    {
+        size_t mid = lo + (hi - lo) / 2;
+        size_t i = g_rodict_word_order[mid];
+        int cmp = strcmp(g_rodict_words[i], word);
+
+        if (cmp == 0)
+        {
+            TRACE("<< find_word_index result=%u", (unsigned)i);
+            return (int)i;
+        }
+        if (cmp < 0)
+        {
+            lo = mid + 1;
+        }
+        else
+        {
+            hi = mid;
+        }
+    }
+
+    TRACE("<< find_word_index result=-1 (not found)");
+
+    return -1;
+}
+
+#else /* !ARM_RODICT */
+
 int find_word_index(Dictionary *dict, const char *word)
 {
     size_t i;
+    size_t j;
 
     TRACE(">> find_word_index word=%s", word ? word : "NULL");
 
@@ -1303,7 +4271,24 @@ int find_word_index(Dictionary *dict, const char *word)
         return -1;
     }
 
-    for (i = 0; i < GLOBAL.word_count; i++)
+    if (GLOBAL.word_indexed)
+    {
+        /* Probe the word-keyed index built by build_index() */
+        j = (size_t)hash_fnv1a(word) & (WORD_INDEX_SLOTS - 1);
+        while (GLOBAL.word_slots[j])
+        {
+            i = GLOBAL.word_slots[j] - 1;
+            if (strcmp(GLOBAL.entries[i].word, word) == 0)
+            {
+                TRACE("<< find_word_index result=%u", (unsigned)i);
+                return (int)i;
+            }
+            j = (j + 1) & (WORD_INDEX_SLOTS - 1);
+        }
+    }
+
+    /* Linear scan: everything before build_index(), the tail after it */
+    for (i = GLOBAL.word_indexed; i < GLOBAL.word_count; i++)
     {
         if (strcmp(GLOBAL.entries[i].word, word) == 0)
         {
@@ -1317,22 +4302,134 @@ int find_word_index(Dictionary *dict, const char *word)
     return -1;
 }
 
+#endif /* ARM_RODICT */
+
+#if defined(ARM_RODICT)
+
+HashTable *build_index(Dictionary *dict)
+{
+    HashTable *ht;
+    size_t len;
+
+    TRACE(">> build_index");
+
+    UNUSED(dict);
+
+    /* The index was generated at build time: no signature computation,
+     * no insert pass. Only the length counts that bound the DFS are
+     * copied out of flash, and the table is query-ready. */
+    ht = hashtable_create(POOL_HASH_BUCKETS);
+
+    for (len = 0; len <= POOL_MAX_WORD_LEN; len++)
+    {
+        GLOBAL.len_word_counts[len] =
+            (len <= g_rodict_max_sig_len) ? g_rodict_len_counts[len] : 0;
+    }
+    GLOBAL.max_sig_len = g_rodict_max_sig_len;
+    GLOBAL.len_parts_built = (GLOBAL.word_count > 0);
+    GLOBAL.hashtable.entry_count = g_rodict_entry_count;
+
+    TRACE("<< build_index entries=%u", (unsigned)g_rodict_entry_count);
+
+    return ht;
+}
+
+const char *get_word(size_t idx)
+{
+    if (idx < GLOBAL.word_count)
+    {
+        return entry_word(idx);
+    }
+    return "";
+}
+
+#else /* !ARM_RODICT */
+
 HashTable *build_index(Dictionary *dict)
 {
     HashTable *ht;
     size_t i;
+    size_t j;
+    size_t len;
+    size_t populated;
+    size_t span;
+    size_t offset;
 
     TRACE(">> build_index");
 
     UNUSED(dict);
 
+    /* Pass 1: words per signature length. Sizes the partitions below and
+     * records the maximum populated length, which bounds chain depth */
+    memset(GLOBAL.len_word_counts, 0, sizeof(GLOBAL.len_word_counts));
+    GLOBAL.max_sig_len = 0;
+    populated = 0;
+    for (i = 0; i < GLOBAL.word_count; i++)
+    {
+        len = strlen(GLOBAL.entries[i].signature);
+        if (GLOBAL.len_word_counts[len]++ == 0)
+        {
+            populated++;
+        }
+        if (len > GLOBAL.max_sig_len)
+        {
+            GLOBAL.max_sig_len = len;
+        }
+    }
+
+    /* Carve the bucket array into one contiguous partition per populated
+     * length, sized proportionally to its word count: every populated
+     * length gets at least one bucket and the total never exceeds
+     * POOL_HASH_BUCKETS. Must precede the inserts - sig_bucket() routes
+     * through the partitions as soon as len_parts_built is set */
+    span = (GLOBAL.word_count && populated < POOL_HASH_BUCKETS)
+               ? POOL_HASH_BUCKETS - populated
+               : 0;
+    offset = 0;
+    for (len = 0; len <= POOL_MAX_WORD_LEN; len++)
+    {
+        GLOBAL.len_part_offset[len] = offset;
+        GLOBAL.len_part_size[len] = 0;
+        if (GLOBAL.len_word_counts[len])
+        {
+            GLOBAL.len_part_size[len] =
+                1 + span * GLOBAL.len_word_counts[len] / GLOBAL.word_count;
+            offset += GLOBAL.len_part_size[len];
+        }
+    }
+
     ht = hashtable_create(POOL_HASH_BUCKETS);
+    GLOBAL.len_parts_built = (GLOBAL.word_count > 0);
 
     for (i = 0; i < GLOBAL.word_count; i++)
     {
         hashtable_insert(ht, GLOBAL.entries[i].signature, i);
     }
 
+    /* Word-keyed index for O(1) find_word_index(); at most half full
+     * since WORD_INDEX_SLOTS >= 2 * POOL_MAX_WORDS */
+    memset(GLOBAL.word_slots, 0, sizeof(GLOBAL.word_slots));
+    for (i = 0; i < GLOBAL.word_count; i++)
+    {
+        j = (size_t)hash_fnv1a(GLOBAL.entries[i].word) &
+            (WORD_INDEX_SLOTS - 1);
+        while (GLOBAL.word_slots[j])
+        {
+            if (strcmp(GLOBAL.entries[GLOBAL.word_slots[j] - 1].word,
+                       GLOBAL.entries[i].word) == 0)
+            {
+                /* Duplicate word - keep the first index, like the scan */
+                break;
+            }
+            j = (j + 1) & (WORD_INDEX_SLOTS - 1);
+        }
+        if (!GLOBAL.word_slots[j])
+        {
+            GLOBAL.word_slots[j] = (uint32_t)i + 1;
+        }
+    }
+    GLOBAL.word_indexed = GLOBAL.word_count;
+
     TRACE("<< build_index entries=%u", (unsigned)GLOBAL.hash_entry_count);
 
     return ht;
@@ -1342,9 +4439,34 @@ const char *get_word(size_t idx)
 {
     if (idx < GLOBAL.word_count)
     {
-        return GLOBAL.entries[idx].word;
+        return entry_word(idx);
     }
     return "";
 }
 
+#endif /* ARM_RODICT */
+
+/* Snapshots rely on pool-relative offsets; only the dynamic build has them */
+int dictionary_snapshot_save(const char *fname, Dictionary *dict,
+                             HashTable *ht)
+{
+    UNUSED(fname);
+    UNUSED(dict);
+    UNUSED(ht);
+
+    TRACE_ERR("snapshots not supported in static memory mode");
+
+    return -1;
+}
+
+HashTable *dictionary_snapshot_load(const char *fname, Dictionary *dict)
+{
+    UNUSED(fname);
+    UNUSED(dict);
+
+    TRACE_ERR("snapshots not supported in static memory mode");
+
+    return NULL;
+}
+
 #endif /* USE_DYNAMIC_MEMORY */
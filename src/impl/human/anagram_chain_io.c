@@ -7,18 +7,33 @@
 
 #include "global.h"
 
+#if !defined(PLATFORM_ARM)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
 /* Defined in anagram_chain_core.c - returns word by index */
 extern const char *get_word(size_t idx);
 
+/* Defined in anagram_chain_core.c - zero-copy dictionary support */
+extern int dictionary_add_ref(Dictionary *dict, char *word, size_t len);
+#if defined(USE_DYNAMIC_MEMORY)
+extern void dictionary_set_mapping(void *base, size_t size);
+#endif
+
 /* Timer functions */
 
 double timer_now(void)
 {
 #if defined(PLATFORM_ARM)
-    TRACE(">> timer_now");
-    TRACE("<< timer_now result=0.0 (ARM)");
+    /* Ride the trace time hook: the bare-metal build overrides it from
+     * the SysTick driver (arm/timer.c), FreeRTOS from the RTOS tick.
+     * With only the weak default linked this stays at 0.0 as before. */
+    trace_update_time();
 
-    return 0.0;
+    return (double)g_trace_tick_us / 1000.0;
 #else
     struct timespec ts;
     double result;
@@ -215,26 +230,206 @@ int load_dictionary(const char *fname, Dictionary *dict)
 #endif
 }
 
+int load_dictionary_mmap(const char *fname, Dictionary *dict)
+{
+#if defined(PLATFORM_ARM)
+    TRACE(">> load_dictionary_mmap fname=%s", fname ? fname : "NULL");
+
+    UNUSED(dict);
+    UNUSED(fname);
+
+    TRACE_ERR("file loading not supported on ARM");
+    OUTPUT("Error: File loading not supported on ARM\n");
+
+    return -1;
+#else
+    int fd;
+    struct stat st;
+    char *base;
+    char *p;
+    char *end;
+    char *line;
+    size_t len;
+    int n;
+
+    TRACE(">> load_dictionary_mmap fname=%s", fname ? fname : "NULL");
+
+    if (!fname)
+    {
+        TRACE_ERR("fname is NULL");
+        return -1;
+    }
+
+    ASSERT_NOT_NULL(dict);
+
+    fd = open(fname, O_RDONLY);
+    if (fd < 0)
+    {
+        TRACE_ERR("cannot open file");
+        OUTPUT("Error: Cannot open '%s'\n", fname);
+        return -1;
+    }
+
+    if (fstat(fd, &st) != 0 || st.st_size == 0)
+    {
+        TRACE_ERR("cannot stat file or file is empty");
+        close(fd);
+        return -1;
+    }
+
+    /* Private mapping: newline terminators are rewritten to '\0' in place,
+     * copy-on-write keeps the file itself untouched. */
+    base = mmap(NULL, (size_t)st.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE,
+                fd, 0);
+    close(fd);
+    if (base == MAP_FAILED)
+    {
+        TRACE_ERR("mmap failed");
+        return -1;
+    }
+
+    n = 0;
+    p = base;
+    end = base + st.st_size;
+
+    while (p < end)
+    {
+        line = p;
+
+        /* Scan to end of line */
+        while (p < end && *p != '\n')
+        {
+            p++;
+        }
+        len = (size_t)(p - line);
+        if (p < end)
+        {
+            p++; /* Skip the newline */
+        }
+
+        /* Trim trailing whitespace */
+        while (len > 0 &&
+               (line[len - 1] == '\r' || line[len - 1] == ' ' ||
+                line[len - 1] == '\t'))
+        {
+            len--;
+        }
+
+        if (line + len == end)
+        {
+            /* Last line without newline: no room for the terminator in the
+             * mapping, copy through the regular path instead. */
+            WordBuffer buf;
+
+            if (len && len < sizeof(buf))
+            {
+                memcpy(buf, line, len);
+                buf[len] = '\0';
+                if (is_valid_word(buf) && dictionary_add(dict, buf) == 0)
+                {
+                    n++;
+                }
+            }
+            break;
+        }
+
+        line[len] = '\0';
+
+        if (len && is_valid_word(line) &&
+            dictionary_add_ref(dict, line, len) == 0)
+        {
+            n++;
+        }
+    }
+
+#if defined(USE_DYNAMIC_MEMORY)
+    /* Words reference the mapping; keep it alive with the dictionary */
+    dictionary_set_mapping(base, (size_t)st.st_size);
+#else
+    /* Static mode copied every word - the mapping can go right away */
+    munmap(base, (size_t)st.st_size);
+#endif
+
+    TRACE("<< load_dictionary_mmap result=%d", n);
+
+    return n;
+#endif
+}
+
 /* Output functions */
 
-void print_chain(Dictionary *dict, Chain *chain)
+/* Buffered result writer: words are accumulated here and flushed with
+ * one bulk write (fwrite on PC, block UART transmit on ARM) per chain
+ * instead of one OUTPUT() call per word and separator. Ordering with
+ * direct OUTPUT() is safe because every public entry point flushes
+ * before returning. */
+static char g_out_buf[OUTPUT_BUF_SIZE];
+static size_t g_out_used;
+
+static void out_flush(void)
 {
-    size_t i;
+    if (g_out_used == 0)
+    {
+        return;
+    }
 
-    UNUSED(dict);
-    ASSERT_NOT_NULL(chain);
-    ASSERT_NOT_NULL(chain->indices);
+#if defined(PLATFORM_ARM)
+    uart_write(g_out_buf, (unsigned)g_out_used);
+#else
+    fwrite(g_out_buf, 1, g_out_used, stdout);
+#endif
+
+    g_out_used = 0;
+}
+
+static void out_write(const char *s, size_t len)
+{
+    size_t room;
+    size_t n;
+
+    while (len > 0)
+    {
+        room = sizeof(g_out_buf) - g_out_used;
+        n = (len < room) ? len : room;
+        memcpy(g_out_buf + g_out_used, s, n);
+        g_out_used += n;
+        s += n;
+        len -= n;
+
+        if (g_out_used == sizeof(g_out_buf))
+        {
+            out_flush();
+        }
+    }
+}
+
+/* Format one chain into the writer without flushing */
+static void out_chain(Chain *chain)
+{
+    size_t i;
+    const char *word;
 
     for (i = 0; i < chain->length; i++)
     {
-        OUTPUT("%s", get_word(chain->indices[i]));
+        word = get_word(chain->indices[i]);
+        out_write(word, strlen(word));
         if (i < chain->length - 1)
         {
-            OUTPUT("->");
+            out_write("->", 2);
         }
     }
 
-    OUTPUT("\n");
+    out_write("\n", 1);
+}
+
+void print_chain(Dictionary *dict, Chain *chain)
+{
+    UNUSED(dict);
+    ASSERT_NOT_NULL(chain);
+    ASSERT_NOT_NULL(chain->indices);
+
+    out_chain(chain);
+    out_flush();
 }
 
 void print_results(Dictionary *dict, ChainResults *results)
@@ -257,14 +452,54 @@ void print_results(Dictionary *dict, ChainResults *results)
     OUTPUT("\nFound %u chain(s) of length %u:\n", (unsigned)results->count,
            (unsigned)results->max_length);
 
+    /* One buffered writer flush for the whole result set */
     for (i = 0; i < results->count; i++)
     {
-        print_chain(NULL, &results->chains[i]);
+        ASSERT_NOT_NULL(results->chains[i].indices);
+        out_chain(&results->chains[i]);
     }
+    out_flush();
 
     TRACE("<< print_results");
 }
 
+int find_longest_chains_batch(HashTable *ht, Dictionary *dict,
+                              const char **starts, size_t n)
+{
+    size_t i;
+    int resolved;
+    ChainResults *res;
+
+    TRACE(">> find_longest_chains_batch n=%u", (unsigned)n);
+
+    if (!ht || !dict || !starts)
+    {
+        TRACE("<< find_longest_chains_batch (invalid args)");
+        return -1;
+    }
+
+    resolved = 0;
+    for (i = 0; i < n; i++)
+    {
+        OUTPUT("\n=== %s ===\n", starts[i]);
+
+        res = find_longest_chains(ht, dict, starts[i]);
+        if (!res)
+        {
+            OUTPUT("Start word '%s' not found in dictionary\n", starts[i]);
+            continue;
+        }
+
+        print_results(dict, res);
+        chain_results_free(res);
+        resolved++;
+    }
+
+    TRACE("<< find_longest_chains_batch resolved=%d", resolved);
+
+    return resolved;
+}
+
 void print_usage(const char *prog)
 {
     TRACE(">> print_usage");
@@ -279,12 +514,24 @@ void print_usage(const char *prog)
     OUTPUT("Embedded Anagram Chain Demo\n");
     OUTPUT("===========================\n\n");
     OUTPUT("Finds the longest chain of derived anagrams in a dictionary.\n\n");
-    OUTPUT("Usage: %s <dictionary_file> <starting_word>\n\n", prog);
+    OUTPUT("Usage: %s [--threads N] [--stats] <dictionary_file> "
+           "<starting_word>\n",
+           prog);
+    OUTPUT("       %s --compile <dictionary_file> <snapshot_file>\n", prog);
+    OUTPUT("       %s --batch <dictionary_file> <starts_file>\n", prog);
+    OUTPUT("       %s --serve <dictionary_file>\n", prog);
+    OUTPUT("       %s --all <dictionary_file>\n\n", prog);
     OUTPUT("Arguments:\n");
     OUTPUT("  dictionary_file  Path to dictionary file (one word per line)\n");
-    OUTPUT("  starting_word    Word to start the chain from\n\n");
+    OUTPUT("                   or a binary snapshot built with --compile\n");
+    OUTPUT("  starting_word    Word to start the chain from\n");
+    OUTPUT("  starts_file      File with one start word per line\n");
+    OUTPUT("  --threads N      Search worker threads (dynamic build)\n");
+    OUTPUT("  --stats          Print hot-path perf counters after the run\n\n");
     OUTPUT("Example:\n");
     OUTPUT("  %s words.txt abc\n", prog);
+    OUTPUT("  %s --compile words.txt words.snap && %s words.snap abc\n", prog,
+           prog);
 #endif
 
     TRACE("<< print_usage");
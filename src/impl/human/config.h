@@ -24,6 +24,11 @@ extern bool global_trace_enable;
 /* Counting sort array size: must cover all valid char codes (0..ASCII_MAX) */
 #define CHAR_COUNT_SIZE (ASCII_MAX + 1)
 
+/* Count-vector signature: one occurrence counter per printable character.
+ * Equal vectors <=> equal sorted-string signatures, but deriving a candidate
+ * is a single byte increment and comparison is a fixed-length memcmp. */
+#define SIG_VEC_SIZE (ASCII_MAX - ASCII_MIN + 1)
+
 /*
  * Static memory pool configuration
  * No malloc/free - all memory is pre-allocated at compile time
@@ -38,22 +43,31 @@ extern bool global_trace_enable;
 #define POOL_MAX_WORD_LEN          32
 #define POOL_HASH_BUCKETS          (POOL_MAX_WORDS)
 #define POOL_MAX_HASH_ENTRIES      64
-#define POOL_MAX_INDICES_PER_ENTRY 8
+#define POOL_INDEX_SLAB_SIZE       (4 * POOL_MAX_WORDS)
 #define POOL_MAX_CHAINS            8
+#define WORD_INDEX_SLOTS           128 /* Power of two >= 2 * POOL_MAX_WORDS */
 #else
 /* PC: larger limits for stress testing (supports up to 1M words) */
 #define POOL_MAX_WORDS             1000000
 #define POOL_MAX_WORD_LEN          257
 #define POOL_HASH_BUCKETS          (POOL_MAX_WORDS)
 #define POOL_MAX_HASH_ENTRIES      (POOL_MAX_WORDS)
-#define POOL_MAX_INDICES_PER_ENTRY 256
+#define POOL_INDEX_SLAB_SIZE       (4 * POOL_MAX_WORDS)
 #define POOL_MAX_CHAINS            16384
+#define WORD_INDEX_SLOTS           2097152 /* Power of two >= 2 * POOL_MAX_WORDS */
 #endif
 
 #define MAX_CHAIN_DEPTH    (POOL_MAX_WORD_LEN)
 #define POOL_MAX_CHAIN_LEN (MAX_CHAIN_DEPTH)
 #define SIG_BUFFER_COUNT   8
 
+/* Worker threads for the parallel chain search (dynamic memory mode, PC).
+ * Overridable from the Makefile: make SEARCH_THREADS=8 */
+#ifndef SEARCH_DEFAULT_THREADS
+#define SEARCH_DEFAULT_THREADS 1
+#endif
+#define SEARCH_MAX_THREADS 64
+
 /*
  * Generic buffer pool for temporary allocations
  * Each buffer can hold the largest structure we need
@@ -61,6 +75,14 @@ extern bool global_trace_enable;
 #define POOL_BUFFER_SIZE  4096
 #define POOL_BUFFER_COUNT 32
 
+/* Buffered result writer: chains are formatted here and flushed in bulk
+ * instead of one OUTPUT() call per word. Small on ARM to spare SRAM. */
+#if defined(PLATFORM_ARM)
+#define OUTPUT_BUF_SIZE 512
+#else
+#define OUTPUT_BUF_SIZE 65536
+#endif
+
 /*
  * Override anagram_chain.h defaults with human-specific values
  * These must be defined before including anagram_chain.h
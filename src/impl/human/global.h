@@ -20,16 +20,26 @@
 #include <stdlib.h>
 #endif
 
+#if !defined(PLATFORM_ARM)
+#include <sys/mman.h>
+#endif
+
+#if !defined(PLATFORM_ARM) && defined(USE_DYNAMIC_MEMORY)
+#include <pthread.h>
+#endif
+
 /* config.h must be included first to override constants in anagram_chain.h */
 #include "config.h"
 #include "anagram_chain.h"
 #include "trace.h"
 #include "assert.h"
+#include "perf_stats.h"
 
 #define UNUSED(x) ((void)(x))
 
 typedef char WordBuffer[POOL_MAX_WORD_LEN];
 typedef size_t ChainPath[MAX_CHAIN_DEPTH];
+typedef unsigned char SigVec[SIG_VEC_SIZE];
 
 typedef struct
 {
@@ -50,6 +60,15 @@ typedef struct
     size_t length;
 } ChainStorage;
 
+/* Arena block header; allocation data follows the header in the same
+ * malloc. Blocks are chained newest-first and grow geometrically. */
+typedef struct ArenaBlock
+{
+    struct ArenaBlock *next;
+    size_t size;
+    size_t used;
+} ArenaBlock;
+
 /* Memory pools for dynamic allocation mode */
 typedef struct
 {
@@ -58,6 +77,13 @@ typedef struct
     size_t pool_size;
     size_t word_used;
     size_t sig_used;
+
+    /* File mapping backing zero-copy loaded words (NULL if not mapped) */
+    void *map_base;
+    size_t map_size;
+
+    /* Bump arena for hash entries and word-index arrays */
+    ArenaBlock *entry_arena;
 } MemoryPools;
 
 #endif /* GLOBAL_H_ */
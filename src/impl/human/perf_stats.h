@@ -0,0 +1,61 @@
+/*
+ * perf_stats.h - Hot-path performance counters
+ *
+ * Lightweight counters incremented from the DFS and hash table hot paths,
+ * so slow searches can be explained with numbers instead of guesswork:
+ * nodes visited, candidate probe hit rate, hash probe lengths, pool usage.
+ *
+ * Usage:
+ *   PERF_COUNT(dfs_nodes);
+ *   perf_stats_print();        (or perf_stats_get() for the raw numbers)
+ *
+ * Compile-time configuration (see Makefile):
+ *   PERF_STATS    1: counters compiled in (default)
+ *                 0: PERF_COUNT compiles to nothing - zero hot-path code
+ *
+ * The counters are plain increments, not atomics: totals are approximate
+ * when the search runs with --threads > 1.
+ */
+
+#ifndef PERF_STATS_H_
+#define PERF_STATS_H_
+
+#include <stddef.h>
+
+#ifndef PERF_STATS
+#define PERF_STATS 1
+#endif
+
+typedef struct
+{
+    unsigned long dfs_nodes;    /* DFS nodes visited */
+    unsigned long probe_hits;   /* Candidate signatures that existed */
+    unsigned long probe_misses; /* Candidate signatures that did not */
+    unsigned long ht_inserts;   /* hashtable_insert() calls */
+    unsigned long ht_finds;     /* hashtable_find() calls */
+    unsigned long ht_steps;     /* Slots/entries examined across finds */
+    size_t pool_word_bytes;     /* Word storage in use (filled on get) */
+    size_t pool_sig_bytes;      /* Signature/index storage in use */
+} PerfStats;
+
+/*
+ * Snapshot the counters; the pool fields are sampled at call time.
+ * Dynamic mode reports MemoryPools usage, static mode the bytes of the
+ * fixed word-entry and hash-entry pools actually occupied.
+ */
+void perf_stats_get(PerfStats *out);
+
+/* Print the counters via OUTPUT */
+void perf_stats_print(void);
+
+/* Zero the counters (pool fields are derived, not stored) */
+void perf_stats_reset(void);
+
+#if PERF_STATS
+extern PerfStats g_perf_stats;
+#define PERF_COUNT(field) (g_perf_stats.field++)
+#else
+#define PERF_COUNT(field) ((void)0)
+#endif
+
+#endif /* PERF_STATS_H_ */
@@ -0,0 +1,52 @@
+/*
+ * rodict.h - Build-time generated read-only dictionary (ARM_RODICT)
+ *
+ * Declares the tables emitted by gen_rodict.py. All of them are const,
+ * so on the embedded targets they live in flash and replace the SRAM
+ * word pool, StaticHashEntry pool and bucket array entirely: boot goes
+ * straight to query-ready with no per-word signature computation or
+ * hashtable_insert() pass.
+ *
+ * Lookups binary-search g_rodict_entries, which is sorted by signature
+ * byte order; g_rodict_sig_bits is the flash counterpart of the bucket
+ * occupancy bitmap and rejects most non-existent candidate signatures
+ * with one bit test before the search.
+ */
+
+#ifndef RODICT_H_
+#define RODICT_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+/* One unique signature: its word list is a run in g_rodict_indices */
+typedef struct
+{
+    const char *signature;
+    uint32_t index_offset; /* First posting in g_rodict_indices */
+    uint32_t word_count;   /* Postings in the run */
+} RoDictEntry;
+
+/* Words and their precomputed signatures, in input order */
+extern const char *const g_rodict_words[];
+extern const char *const g_rodict_sigs[];
+extern const size_t g_rodict_word_count;
+
+/* Unique signatures sorted by byte order, plus their posting slab */
+extern const RoDictEntry g_rodict_entries[];
+extern const size_t g_rodict_entry_count;
+extern const size_t g_rodict_indices[];
+
+/* Word indices sorted by word byte order, for start-word resolution */
+extern const uint32_t g_rodict_word_order[];
+
+/* Signature occupancy bitmap over rodict_hash32() (see gen_rodict.py) */
+extern const uint32_t g_rodict_sig_bits[];
+extern const size_t g_rodict_sig_bits_words;
+
+/* Words per signature length, 0..max+1; bounds the DFS like the
+ * len_word_counts pass in build_index() */
+extern const size_t g_rodict_len_counts[];
+extern const size_t g_rodict_max_sig_len;
+
+#endif /* RODICT_H_ */
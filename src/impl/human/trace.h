@@ -5,20 +5,41 @@
  *   TRACE(">> func_name param=%d", param);
  *   TRACE("<< func_name result=%d", result);
  *   TRACE_ERR("func_name: error message");
+ *   TRACE_EVENT(TRACE_EV_HT_FIND, hash);   (binary builds only)
  *
  * Enable/disable via global_trace_enable flag.
+ *
+ * Compile-time configuration (see Makefile):
+ *   TRACE_LEVEL   0: all text tracing compiled out - zero hot-path code
+ *                 1: TRACE_ERR only
+ *                 2: full TRACE + TRACE_ERR (default)
+ *   TRACE_BINARY  Log TRACE_EVENT records into a RAM ring buffer instead
+ *                 of formatting text; implies TRACE_LEVEL 1 so hot-path
+ *                 timing is not distorted by printf/UART. Drain with
+ *                 trace_ring_drain() after the run.
  */
 
 #ifndef TRACE_H_
 #define TRACE_H_
 
 #include <stdbool.h>
+#include <stdint.h>
 #include <stdio.h>
 
 extern bool global_trace_enable;
 
 #define TRACE_BUF_SIZE 256
 
+#ifndef TRACE_LEVEL
+#define TRACE_LEVEL 2
+#endif
+
+/* Binary mode replaces hot-path text tracing; errors stay as text */
+#if defined(TRACE_BINARY)
+#undef TRACE_LEVEL
+#define TRACE_LEVEL 1
+#endif
+
 #if defined(PLATFORM_ARM)
 /* ARM platform - use UART for output */
 #include "uart.h"
@@ -29,7 +50,7 @@ extern volatile unsigned int g_trace_tick_us;
 /* Update trace timer - call this before using g_trace_tick_us */
 void trace_update_time(void);
 
-#define TRACE(fmt, ...)                                                  \
+#define TRACE_PRINT(fmt, ...)                                            \
     do                                                                   \
     {                                                                    \
         if (global_trace_enable)                                         \
@@ -66,7 +87,7 @@ static inline void trace_utc_time(char *buf, int bufsize)
              tm->tm_sec, ms);
 }
 
-#define TRACE(fmt, ...)                                                       \
+#define TRACE_PRINT(fmt, ...)                                                 \
     do                                                                        \
     {                                                                         \
         if (global_trace_enable)                                              \
@@ -84,6 +105,12 @@ static inline void trace_utc_time(char *buf, int bufsize)
 
 #endif
 
+#if TRACE_LEVEL >= 2
+#define TRACE(fmt, ...) TRACE_PRINT(fmt, ##__VA_ARGS__)
+#else
+#define TRACE(fmt, ...) ((void)0)
+#endif
+
 /* Extract filename from path */
 #define TRACE_FILE                \
     ({                            \
@@ -98,13 +125,61 @@ static inline void trace_utc_time(char *buf, int bufsize)
         f;                        \
     })
 
-#define TRACE_ERR(fmt, ...)                                   \
-    do                                                        \
-    {                                                         \
-        if (global_trace_enable)                              \
-        {                                                     \
-            TRACE("ERROR %s: " fmt, __func__, ##__VA_ARGS__); \
-        }                                                     \
+#if TRACE_LEVEL >= 1
+#define TRACE_ERR(fmt, ...)                                         \
+    do                                                              \
+    {                                                               \
+        if (global_trace_enable)                                    \
+        {                                                           \
+            TRACE_PRINT("ERROR %s: " fmt, __func__, ##__VA_ARGS__); \
+        }                                                           \
     } while (0)
+#else
+#define TRACE_ERR(fmt, ...) ((void)0)
+#endif
+
+/*
+ * Binary trace ring: fixed-size records in RAM, one tick read and a few
+ * stores per event - no formatting, no UART - so it can stay enabled
+ * while timing on device. Wraps when full, keeping the newest records.
+ */
+
+#define TRACE_RING_RECORDS 256 /* Power of two keeps the wrap cheap */
+
+/* Event ids for TRACE_EVENT callsites */
+enum
+{
+    TRACE_EV_HT_INSERT = 1, /* arg = word index */
+    TRACE_EV_HT_FIND,       /* arg = bucket/slot */
+    TRACE_EV_DFS_LEAF,      /* arg = chain length */
+};
+
+typedef struct
+{
+    uint16_t id;   /* TRACE_EV_* event id */
+    uint16_t line; /* Source line of the callsite */
+    uint32_t tick; /* Microsecond tick at log time */
+    uint32_t arg;  /* Event argument */
+} TraceRecord;
+
+/* Append one record to the ring (anagram_chain_core.c) */
+void trace_ring_log(uint16_t id, uint16_t line, uint32_t arg);
+
+/* Print and reset the ring, oldest surviving record first */
+void trace_ring_drain(void);
+
+#if defined(TRACE_BINARY)
+#define TRACE_EVENT(id, arg)                                            \
+    do                                                                  \
+    {                                                                   \
+        if (global_trace_enable)                                        \
+        {                                                               \
+            trace_ring_log((uint16_t)(id), (uint16_t)__LINE__,          \
+                           (uint32_t)(arg));                            \
+        }                                                               \
+    } while (0)
+#else
+#define TRACE_EVENT(id, arg) ((void)0)
+#endif
 
 #endif /* TRACE_H_ */
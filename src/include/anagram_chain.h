@@ -94,13 +94,20 @@ typedef struct
 
 /**
  * @brief Collection of found chains
+ *
+ * Chain index arrays slice into one shared pool, so discarding shorter
+ * chains when a longer one appears is a pointer reset rather than a free
+ * loop. Builds with fixed storage leave the pool fields unused (NULL).
  */
 typedef struct
 {
-    Chain *chains;     /**< Array of chains */
-    size_t count;      /**< Number of chains */
-    size_t capacity;   /**< Allocated capacity */
-    size_t max_length; /**< Length of longest chains */
+    Chain *chains;        /**< Array of chains */
+    size_t count;         /**< Number of chains */
+    size_t capacity;      /**< Allocated capacity */
+    size_t max_length;    /**< Length of longest chains */
+    size_t *index_pool;   /**< Backing pool all chain indices slice into */
+    size_t pool_used;     /**< Pool entries in use */
+    size_t pool_capacity; /**< Allocated pool entries */
 } ChainResults;
 
 /* ============================================================================
@@ -183,6 +190,20 @@ int dictionary_add(Dictionary *dict, const char *word);
  */
 int load_dictionary(const char *filename, Dictionary *dict);
 
+/**
+ * @brief Load dictionary from file using a memory-mapped zero-copy path
+ *
+ * Maps the file privately, terminates lines in place and (in dynamic memory
+ * mode) points Dictionary.words entries directly at the mapped region instead
+ * of copying each word into the word pool. Falls back gracefully: callers can
+ * retry with load_dictionary() if this returns -1.
+ *
+ * @param filename Path to dictionary file
+ * @param dict Dictionary to populate
+ * @return Number of words loaded, or -1 on error
+ */
+int load_dictionary_mmap(const char *filename, Dictionary *dict);
+
 /**
  * @brief Find word index in dictionary
  * @param dict Dictionary to search
@@ -232,6 +253,39 @@ HashEntry *hashtable_find(HashTable *ht, const char *signature);
  */
 HashTable *build_index(Dictionary *dict);
 
+/* ============================================================================
+ * Snapshot Functions (dynamic memory mode, PC only)
+ * ============================================================================
+ */
+
+/**
+ * @brief Serialize dictionary pools and signature index to a binary snapshot
+ *
+ * The snapshot stores words, precomputed signatures and the hash index with
+ * relocatable offsets, so a later dictionary_snapshot_load() is query-ready
+ * without re-parsing or re-hashing anything.
+ *
+ * @param filename Output snapshot path
+ * @param dict Dictionary to serialize
+ * @param ht Hash index built from dict
+ * @return 0 on success, -1 on failure or if unsupported in this build
+ */
+int dictionary_snapshot_save(const char *filename, Dictionary *dict,
+                             HashTable *ht);
+
+/**
+ * @brief Load a binary snapshot produced by dictionary_snapshot_save()
+ *
+ * Maps the snapshot and points words, signatures and index entries directly
+ * into the mapping; the mapping is released in dictionary_free().
+ *
+ * @param filename Snapshot path
+ * @param dict Dictionary to populate (from dictionary_create())
+ * @return Ready-to-query hash table, or NULL if the file is not a snapshot
+ *         or snapshots are unsupported in this build
+ */
+HashTable *dictionary_snapshot_load(const char *filename, Dictionary *dict);
+
 /* ============================================================================
  * Chain Finder Functions
  * ============================================================================
@@ -267,6 +321,75 @@ void chain_results_free(ChainResults *results);
 ChainResults *find_longest_chains(HashTable *ht, Dictionary *dict,
                                   const char *start_word);
 
+/**
+ * @brief Find the globally longest chains over the whole dictionary
+ *
+ * Searches from chain roots only - signatures that no other signature can
+ * precede - instead of once per word, sharing the per-signature memo
+ * across roots where the build supports it.
+ *
+ * @param ht Hash table index
+ * @param dict Dictionary
+ * @return Chain results, or NULL on error
+ */
+ChainResults *find_longest_chains_all(HashTable *ht, Dictionary *dict);
+
+/**
+ * @brief Run find_longest_chains() for many start words on one warm index
+ *
+ * Prints each start word's results as it goes, so one dictionary load and
+ * index build is amortized over the whole batch. Unknown start words are
+ * reported and skipped.
+ *
+ * @param ht Hash table index
+ * @param dict Dictionary
+ * @param starts Array of start words
+ * @param n Number of start words
+ * @return Number of start words found, or -1 on invalid arguments
+ */
+int find_longest_chains_batch(HashTable *ht, Dictionary *dict,
+                              const char **starts, size_t n);
+
+/**
+ * @brief Callback for find_chains_stream()
+ * @param indices Word indices of the completed chain, in chain order
+ * @param length Chain length in words
+ * @param user Opaque pointer passed through from the caller
+ * @return 0 to continue the search, nonzero to stop it
+ */
+typedef int (*ChainStreamFn)(const size_t *indices, size_t length,
+                             void *user);
+
+/**
+ * @brief Stream maximal chains from a start word as they are found
+ *
+ * Invokes the callback once per maximal chain - one that no word in the
+ * dictionary extends - in depth-first order, without materializing a
+ * ChainResults set. A nonzero callback return stops the search, which
+ * bounds both latency to the first result and result-storage memory.
+ * The indices array is only valid for the duration of the call.
+ *
+ * @param ht Hash table index
+ * @param dict Dictionary
+ * @param start Starting word
+ * @param callback Invoked per maximal chain
+ * @param user Opaque pointer handed to the callback
+ * @return Number of chains delivered (including one that stopped the
+ *         search), or -1 on invalid arguments or unknown start word
+ */
+int find_chains_stream(HashTable *ht, Dictionary *dict, const char *start,
+                       ChainStreamFn callback, void *user);
+
+/**
+ * @brief Set the worker thread count for find_longest_chains()
+ *
+ * Only the dynamic-memory PC build runs the search in parallel; other
+ * builds accept and ignore the setting. Clamped to a sane range.
+ *
+ * @param n Thread count (1 = serial)
+ */
+void search_set_threads(int n);
+
 /* ============================================================================
  * Output Functions
  * ============================================================================
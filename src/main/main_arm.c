@@ -11,84 +11,75 @@
 #include <string.h>
 
 #include "anagram_chain.h"
+#include "timer.h"
 #include "uart.h"
 
 /* ============================================================================
  * Embedded Dictionary
  * ============================================================================
- * Since we can't read files in bare-metal, we embed a test dictionary.
+ * Default mode embeds a test dictionary, since bare-metal has no files.
+ * ARM_UART_DICT replaces it with streaming ingestion over UART, so
+ * realistic dictionaries can be pushed onto the device without
+ * reflashing (see the load section in main()). ARM_RODICT bakes the
+ * dictionary and its index into flash at build time instead; neither
+ * loading path is compiled in.
  */
 
+#if !defined(ARM_UART_DICT) && !defined(ARM_RODICT)
 static const char *embedded_words[] = {
     "abc",     "abcd",   "abcde",   "abcdef",   "abck",
     "abcek",   "abcelk", "baclekt", "abcdg",    "abcdgh",
     "abcdghi", "abcdp",  "bafced",  "akjpqwmn", NULL /* Sentinel */
 };
+#endif
 
 static const char *start_word = "abck";
 
 /* ============================================================================
- * Timer Implementation for ARM
+ * Timing
  * ============================================================================
- * Simple cycle counter using SysTick (approximate timing).
+ * SysTick driver lives in arm/timer.c; it also overrides the trace time
+ * hook, so TRACE timestamps and timer_now() work without further setup.
  */
 
-#define SYSTICK_CTRL (*(volatile unsigned int *)0xE000E010)
-#define SYSTICK_LOAD (*(volatile unsigned int *)0xE000E014)
-#define SYSTICK_VAL  (*(volatile unsigned int *)0xE000E018)
+#if defined(TRACE_BINARY)
+/* Binary trace ring drain (see src/impl/human/trace.h) */
+extern void trace_ring_drain(void);
+#endif
 
-#define SYSTICK_ENABLE  (1 << 0)
-#define SYSTICK_TICKINT (1 << 1) /* Enable interrupt */
-#define SYSTICK_CLKSRC  (1 << 2) /* Use processor clock */
-
-/* LM3S6965 runs at 12 MHz in QEMU */
-#define CPU_FREQ_HZ  12000000
-#define SYSTICK_1MS  (CPU_FREQ_HZ / 1000)
-#define TICKS_PER_US (CPU_FREQ_HZ / 1000000) /* 12 ticks per microsecond */
-
-static volatile unsigned int systick_ms = 0;
-
-/* Trace tick counter in microseconds (declared in trace.h) */
-extern volatile unsigned int g_trace_tick_us;
-
-void SysTick_Handler(void)
+#if defined(ARM_BENCH)
+/* Print an unsigned 64-bit value; cycle counts outgrow uart_putint()
+ * after about three minutes at 12 MHz */
+static void uart_putu64(unsigned long long n)
 {
-    systick_ms++;
-}
+    char buf[21];
+    char *p = buf + sizeof(buf) - 1;
 
-/* Get current time in microseconds */
-static unsigned int timer_arm_get_us(void)
-{
-    unsigned int ms, val;
-    /* Read atomically */
-    do
+    *p = '\0';
+    if (n == 0)
     {
-        ms = systick_ms;
-        val = SYSTICK_VAL;
-    } while (ms != systick_ms);
-
-    /* Calculate microseconds within current ms */
-    unsigned int us_in_ms = (SYSTICK_1MS - 1 - val) / TICKS_PER_US;
-    return ms * 1000 + us_in_ms;
-}
-
-/* Update trace counter - called by TRACE macro */
-void trace_update_time(void)
-{
-    g_trace_tick_us = timer_arm_get_us();
-}
-
-static void timer_arm_init(void)
-{
-    SYSTICK_LOAD = SYSTICK_1MS - 1; /* 1ms interval */
-    SYSTICK_VAL = 0;
-    SYSTICK_CTRL = SYSTICK_ENABLE | SYSTICK_TICKINT | SYSTICK_CLKSRC;
+        *--p = '0';
+    }
+    while (n > 0)
+    {
+        *--p = '0' + (char)(n % 10);
+        n /= 10;
+    }
+    uart_puts(p);
 }
 
-static unsigned int timer_arm_get_ms(void)
+/* One line of the benchmark breakdown: phase name, cycles, microseconds */
+static void bench_report(const char *phase, unsigned long long cycles)
 {
-    return systick_ms;
+    uart_puts("  ");
+    uart_puts(phase);
+    uart_puts(": ");
+    uart_putu64(cycles);
+    uart_puts(" cycles (");
+    uart_putu64(cycles / (CPU_FREQ_HZ / 1000000));
+    uart_puts(" us)\n");
 }
+#endif
 
 /* ============================================================================
  * ARM Main Function
@@ -108,10 +99,6 @@ int main(void)
     uart_puts("  Target: LM3S6965 (Cortex-M3)\n");
     uart_puts("========================================\n\n");
 
-    /* Create dictionary from embedded words */
-    uart_puts("Loading embedded dictionary...\n");
-    unsigned int start_ticks = timer_arm_get_ms();
-
     Dictionary *dict = dictionary_create(32);
     if (!dict)
     {
@@ -120,6 +107,68 @@ int main(void)
     }
 
     int count = 0;
+
+#if defined(ARM_RODICT)
+    /* Dictionary and index were generated at build time into flash;
+     * dictionary_create() already wired the tables up, so there is
+     * nothing to load. */
+    uart_puts("Using build-time flash dictionary.\n");
+    unsigned long long start_cycles = timer_arm_get_cycles();
+    count = (int)dict->count;
+
+    /* The compiled-in default start word may not be in the generated
+     * wordlist; fall back to its first word so the demo still runs. */
+    if (find_word_index(dict, start_word) < 0 && dict->count > 0)
+    {
+        start_word = dict->words[0];
+    }
+#elif defined(ARM_UART_DICT)
+    /* Streaming ingestion: the RX interrupt keeps filling its ring
+     * while dictionary_add() computes signatures in the foreground, so
+     * ingestion runs at line rate up to POOL_MAX_WORDS. */
+    static char start_buf[64];
+    static char line[64];
+    int n;
+
+    uart_puts("Streaming dictionary mode.\n");
+    uart_puts("Send the start word first, then one word per line;\n");
+    uart_puts("finish with a '.' line or Ctrl-D.\n");
+    uart_rx_start();
+
+    do
+    {
+        n = uart_readline(start_buf, sizeof(start_buf));
+    } while (n == 0); /* Skip blank lines (CRLF) */
+
+    if (n < 0)
+    {
+        uart_puts("ERROR: No start word received\n");
+        dictionary_free(dict);
+        return 1;
+    }
+    start_word = start_buf;
+
+    unsigned long long start_cycles = timer_arm_get_cycles();
+    while ((n = uart_readline(line, sizeof(line))) >= 0)
+    {
+        if (n == 0)
+        {
+            continue;
+        }
+        if (line[0] == '.' && line[1] == '\0')
+        {
+            break;
+        }
+        if (dictionary_add(dict, line) == 0)
+        {
+            count++;
+        }
+    }
+#else
+    /* Create dictionary from embedded words */
+    uart_puts("Loading embedded dictionary...\n");
+    unsigned long long start_cycles = timer_arm_get_cycles();
+
     for (const char **w = embedded_words; *w != NULL; w++)
     {
         if (dictionary_add(dict, *w) == 0)
@@ -127,13 +176,14 @@ int main(void)
             count++;
         }
     }
+#endif
 
-    unsigned int load_ticks = timer_arm_get_ms() - start_ticks;
+    unsigned long long load_cycles = timer_arm_get_cycles() - start_cycles;
     uart_puts("Words loaded: ");
     uart_putint(count);
     uart_puts(" (");
-    uart_putint(load_ticks);
-    uart_puts(" ticks)\n");
+    uart_putint((int)(load_cycles / (CPU_FREQ_HZ / 1000000)));
+    uart_puts(" us)\n");
 
     /* Verify start word exists */
     if (find_word_index(dict, start_word) < 0)
@@ -147,7 +197,7 @@ int main(void)
 
     /* Build index */
     uart_puts("\nBuilding index...\n");
-    start_ticks = timer_arm_get_ms();
+    start_cycles = timer_arm_get_cycles();
 
     HashTable *index = build_index(dict);
     if (!index)
@@ -157,25 +207,25 @@ int main(void)
         return 1;
     }
 
-    unsigned int index_ticks = timer_arm_get_ms() - start_ticks;
+    unsigned long long index_cycles = timer_arm_get_cycles() - start_cycles;
     uart_puts("Unique signatures: ");
     uart_putint((int)index->entry_count);
     uart_puts(" (");
-    uart_putint(index_ticks);
-    uart_puts(" ticks)\n");
+    uart_putint((int)(index_cycles / (CPU_FREQ_HZ / 1000000)));
+    uart_puts(" us)\n");
 
     /* Find chains */
     uart_puts("\nSearching for chains from '");
     uart_puts(start_word);
     uart_puts("'...\n");
-    start_ticks = timer_arm_get_ms();
+    start_cycles = timer_arm_get_cycles();
 
     ChainResults *results = find_longest_chains(index, dict, start_word);
 
-    unsigned int search_ticks = timer_arm_get_ms() - start_ticks;
+    unsigned long long search_cycles = timer_arm_get_cycles() - start_cycles;
     uart_puts("Search completed (");
-    uart_putint(search_ticks);
-    uart_puts(" ticks)\n");
+    uart_putint((int)(search_cycles / (CPU_FREQ_HZ / 1000000)));
+    uart_puts(" us)\n");
 
     /* Print results */
     if (results && results->count > 0)
@@ -217,6 +267,22 @@ int main(void)
     hashtable_free(index);
     dictionary_free(dict);
 
+#if defined(ARM_BENCH)
+    /* Benchmark boot mode: per-phase cycle/microsecond breakdown for
+     * comparing on-device performance across firmware revisions */
+    uart_puts("\nBenchmark breakdown (");
+    uart_putint(CPU_FREQ_HZ / 1000000);
+    uart_puts(" MHz):\n");
+    bench_report("load  ", load_cycles);
+    bench_report("index ", index_cycles);
+    bench_report("search", search_cycles);
+    bench_report("total ", load_cycles + index_cycles + search_cycles);
+#endif
+
+#if defined(TRACE_BINARY)
+    trace_ring_drain();
+#endif
+
     uart_puts("\n========================================\n");
     uart_puts("  Done!\n");
     uart_puts("========================================\n");
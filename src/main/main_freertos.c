@@ -2,8 +2,12 @@
  * @file main_freertos.c
  * @brief FreeRTOS main entry point for LM3S6965
  *
- * Creates a FreeRTOS task that runs the anagram chain algorithm.
- * Demonstrates RTOS integration for embedded systems.
+ * Runs the anagram chain algorithm as a three-stage task pipeline:
+ * a producer feeds words through a queue (standing in for a comms
+ * link), an indexer adds each word and inserts its signature as it
+ * arrives, and a search task starts as soon as the index is complete.
+ * Indexing overlaps ingestion, so the device is query-ready sooner
+ * than with a load-everything-then-index structure.
  */
 
 #include <stdio.h>
@@ -12,6 +16,7 @@
 
 #include "FreeRTOS.h"
 #include "anagram_chain.h"
+#include "queue.h"
 #include "task.h"
 #include "uart.h"
 
@@ -28,39 +33,93 @@ void trace_update_time(void)
  * Embedded Dictionary
  * ============================================================================
  * Since we can't read files in bare-metal, we embed a test dictionary.
+ * Under ARM_RODICT the dictionary and index live in flash instead and
+ * the producer/indexer stages are compiled out.
  */
 
+#if !defined(ARM_RODICT)
 static const char *embedded_words[] = {
     "abc",     "abcd",   "abcde",   "abcdef",   "abck",
     "abcek",   "abcelk", "baclekt", "abcdg",    "abcdgh",
     "abcdghi", "abcdp",  "bafced",  "akjpqwmn", NULL /* Sentinel */
 };
+#endif
 
 static const char *start_word = "abck";
 
 /* ============================================================================
- * Anagram Task
+ * Pipeline Tasks
  * ============================================================================
+ * producer --(word queue)--> indexer --(ready queue)--> search
+ *
+ * The word queue carries one word pointer per message; NULL is the
+ * end-of-stream sentinel. The ready queue has depth one and hands the
+ * finished dictionary and index to the search task.
  */
 
-#define ANAGRAM_TASK_STACK_SIZE (2048) /* Words */
-#define ANAGRAM_TASK_PRIORITY   (tskIDLE_PRIORITY + 1)
+#define PRODUCER_TASK_STACK_SIZE (256)  /* Words */
+#define ANAGRAM_TASK_STACK_SIZE  (2048) /* Words */
+
+/* Indexer runs above the producer so each word is consumed as it
+ * arrives instead of piling up in the queue */
+#define PRODUCER_TASK_PRIORITY (tskIDLE_PRIORITY + 1)
+#define INDEXER_TASK_PRIORITY  (tskIDLE_PRIORITY + 2)
+#define SEARCH_TASK_PRIORITY   (tskIDLE_PRIORITY + 1)
+
+#if !defined(ARM_RODICT)
+
+#define WORD_QUEUE_DEPTH 8
+
+/* Handed from indexer to search when the index is complete */
+typedef struct
+{
+    Dictionary *dict;
+    HashTable *index;
+} PipelineReady;
+
+static QueueHandle_t xWordQueue;
+static QueueHandle_t xReadyQueue;
 
 /**
- * @brief FreeRTOS task that runs the anagram chain finder
- * @param pvParameters Unused
+ * @brief Feed words into the pipeline, then the NULL sentinel
+ *
+ * Stands in for a comms link delivering words incrementally; blocks
+ * whenever the queue is full, so ingestion and indexing interleave.
  */
-static void vAnagramTask(void *pvParameters)
+static void vProducerTask(void *pvParameters)
 {
     (void)pvParameters;
 
-    TickType_t xStartTick, xEndTick;
+    int sent = 0;
+
+    for (const char **w = embedded_words; *w != NULL; w++)
+    {
+        xQueueSend(xWordQueue, w, portMAX_DELAY);
+        sent++;
+    }
+
+    const char *sentinel = NULL;
+    xQueueSend(xWordQueue, &sentinel, portMAX_DELAY);
+
+    uart_puts("[producer] words sent: ");
+    uart_putint(sent);
+    uart_puts("\n");
 
-    uart_puts("\n[FreeRTOS Task] Starting anagram chain finder...\n\n");
+    vTaskDelete(NULL);
+}
 
-    /* Create dictionary from embedded words */
-    uart_puts("Loading embedded dictionary...\n");
-    xStartTick = xTaskGetTickCount();
+/**
+ * @brief Add each word and insert its signature as it arrives
+ *
+ * Per-word work happens while the producer is still delivering, so the
+ * index is complete almost as soon as the last word lands. On the
+ * sentinel the finished dictionary and index go to the search task.
+ */
+static void vIndexerTask(void *pvParameters)
+{
+    (void)pvParameters;
+
+    TickType_t xStartTick = xTaskGetTickCount();
 
     Dictionary *dict = dictionary_create(32);
     if (!dict)
@@ -70,37 +129,69 @@ static void vAnagramTask(void *pvParameters)
         return;
     }
 
+    HashTable *index = hashtable_create(32);
+    if (!index)
+    {
+        uart_puts("ERROR: Failed to create hash table\n");
+        dictionary_free(dict);
+        vTaskDelete(NULL);
+        return;
+    }
+
     int count = 0;
-    for (const char **w = embedded_words; *w != NULL; w++)
+    for (;;)
     {
-        if (dictionary_add(dict, *w) == 0)
+        const char *word;
+
+        xQueueReceive(xWordQueue, &word, portMAX_DELAY);
+        if (!word)
         {
+            break; /* End-of-stream sentinel */
+        }
+
+        if (dictionary_add(dict, word) == 0)
+        {
+            hashtable_insert(index, dict->signatures[dict->count - 1],
+                             dict->count - 1);
             count++;
         }
     }
 
-    xEndTick = xTaskGetTickCount();
-    uart_puts("Words loaded: ");
+    TickType_t xEndTick = xTaskGetTickCount();
+    uart_puts("[indexer] words indexed: ");
     uart_putint(count);
+    uart_puts(", unique signatures: ");
+    uart_putint((int)index->entry_count);
     uart_puts(" (");
     uart_putint((int)(xEndTick - xStartTick));
     uart_puts(" ticks)\n");
 
-    /* Verify start word exists */
-    if (find_word_index(dict, start_word) < 0)
+    PipelineReady ready = {dict, index};
+    xQueueSend(xReadyQueue, &ready, portMAX_DELAY);
+
+    vTaskDelete(NULL);
+}
+
+#endif /* !ARM_RODICT */
+
+/**
+ * @brief Run the chain search once the index is ready
+ */
+static void vSearchTask(void *pvParameters)
+{
+    (void)pvParameters;
+
+#if defined(ARM_RODICT)
+    /* Dictionary and index were generated into flash at build time;
+     * there is nothing to ingest, so wire them up directly. */
+    Dictionary *dict = dictionary_create(32);
+    if (!dict)
     {
-        uart_puts("ERROR: Start word not found: ");
-        uart_puts(start_word);
-        uart_puts("\n");
-        dictionary_free(dict);
+        uart_puts("ERROR: Failed to create dictionary\n");
         vTaskDelete(NULL);
         return;
     }
 
-    /* Build index */
-    uart_puts("\nBuilding index...\n");
-    xStartTick = xTaskGetTickCount();
-
     HashTable *index = build_index(dict);
     if (!index)
     {
@@ -110,22 +201,47 @@ static void vAnagramTask(void *pvParameters)
         return;
     }
 
-    xEndTick = xTaskGetTickCount();
-    uart_puts("Unique signatures: ");
+    uart_puts("[search] flash dictionary: ");
+    uart_putint((int)dict->count);
+    uart_puts(" words, ");
     uart_putint((int)index->entry_count);
-    uart_puts(" (");
-    uart_putint((int)(xEndTick - xStartTick));
-    uart_puts(" ticks)\n");
+    uart_puts(" unique signatures\n");
+
+    /* The compiled-in default start word may not be in the generated
+     * wordlist; fall back to its first word so the demo still runs. */
+    if (find_word_index(dict, start_word) < 0 && dict->count > 0)
+    {
+        start_word = dict->words[0];
+    }
+#else
+    PipelineReady ready;
+    xQueueReceive(xReadyQueue, &ready, portMAX_DELAY);
+
+    Dictionary *dict = ready.dict;
+    HashTable *index = ready.index;
+#endif
+
+    /* Verify start word exists */
+    if (find_word_index(dict, start_word) < 0)
+    {
+        uart_puts("ERROR: Start word not found: ");
+        uart_puts(start_word);
+        uart_puts("\n");
+        hashtable_free(index);
+        dictionary_free(dict);
+        vTaskDelete(NULL);
+        return;
+    }
 
     /* Find chains */
     uart_puts("\nSearching for chains from '");
     uart_puts(start_word);
     uart_puts("'...\n");
-    xStartTick = xTaskGetTickCount();
+    TickType_t xStartTick = xTaskGetTickCount();
 
     ChainResults *results = find_longest_chains(index, dict, start_word);
 
-    xEndTick = xTaskGetTickCount();
+    TickType_t xEndTick = xTaskGetTickCount();
     uart_puts("Search completed (");
     uart_putint((int)(xEndTick - xStartTick));
     uart_puts(" ticks)\n");
@@ -194,23 +310,42 @@ int main(void)
     uart_puts("  Target: LM3S6965 (Cortex-M3)\n");
     uart_puts("========================================\n");
 
-    /* Create the anagram task */
-    BaseType_t xResult = xTaskCreate(vAnagramTask, /* Task function */
-                                     "Anagram",    /* Task name */
-                                     ANAGRAM_TASK_STACK_SIZE, /* Stack size
-                                                                 (words) */
-                                     NULL,                    /* Parameters */
-                                     ANAGRAM_TASK_PRIORITY,   /* Priority */
-                                     NULL /* Task handle (not needed) */
-    );
-
-    if (xResult != pdPASS)
+#if defined(ARM_RODICT)
+    /* Flash dictionary: no ingestion pipeline, just the search task */
+    if (xTaskCreate(vSearchTask, "Search", ANAGRAM_TASK_STACK_SIZE, NULL,
+                    SEARCH_TASK_PRIORITY, NULL) != pdPASS)
+    {
+        uart_puts("ERROR: Failed to create tasks\n");
+        while (1)
+        {
+        }
+    }
+#else
+    /* Pipeline queues */
+    xWordQueue = xQueueCreate(WORD_QUEUE_DEPTH, sizeof(const char *));
+    xReadyQueue = xQueueCreate(1, sizeof(PipelineReady));
+    if (!xWordQueue || !xReadyQueue)
+    {
+        uart_puts("ERROR: Failed to create queues\n");
+        while (1)
+        {
+        }
+    }
+
+    /* Pipeline tasks: producer -> indexer -> search */
+    if (xTaskCreate(vProducerTask, "Producer", PRODUCER_TASK_STACK_SIZE, NULL,
+                    PRODUCER_TASK_PRIORITY, NULL) != pdPASS ||
+        xTaskCreate(vIndexerTask, "Indexer", ANAGRAM_TASK_STACK_SIZE, NULL,
+                    INDEXER_TASK_PRIORITY, NULL) != pdPASS ||
+        xTaskCreate(vSearchTask, "Search", ANAGRAM_TASK_STACK_SIZE, NULL,
+                    SEARCH_TASK_PRIORITY, NULL) != pdPASS)
     {
-        uart_puts("ERROR: Failed to create task\n");
+        uart_puts("ERROR: Failed to create tasks\n");
         while (1)
         {
         }
     }
+#endif
 
     uart_puts("\n[main] Starting FreeRTOS scheduler...\n");
 
@@ -11,6 +11,270 @@
 
 #include "anagram_chain.h"
 
+#if defined(TRACE_BINARY) && !defined(IMPL_AI)
+/* Binary trace ring drain (see src/impl/human/trace.h) */
+extern void trace_ring_drain(void);
+#endif
+
+#if !defined(IMPL_AI)
+/* Hot-path performance counters (see src/impl/human/perf_stats.h) */
+extern void perf_stats_print(void);
+#endif
+
+#if !defined(IMPL_AI)
+/**
+ * @brief Compile a text dictionary into a binary snapshot
+ * @param dict_file Input text dictionary
+ * @param snap_file Output snapshot path
+ * @return 0 on success, 1 on failure
+ */
+static int run_compile_mode(const char *dict_file, const char *snap_file)
+{
+    printf("Compiling dictionary: %s -> %s\n", dict_file, snap_file);
+    double start = timer_now();
+
+    Dictionary *dict = dictionary_create(INITIAL_CAPACITY);
+    if (!dict)
+    {
+        fprintf(stderr, "Error: Failed to create dictionary\n");
+        return 1;
+    }
+
+    int loaded = load_dictionary_mmap(dict_file, dict);
+    if (loaded < 0)
+    {
+        loaded = load_dictionary(dict_file, dict);
+    }
+    if (loaded < 0)
+    {
+        dictionary_free(dict);
+        return 1;
+    }
+    printf("Words loaded: %zu\n", dict->count);
+
+    HashTable *index = build_index(dict);
+    if (!index)
+    {
+        fprintf(stderr, "Error: Failed to build index\n");
+        dictionary_free(dict);
+        return 1;
+    }
+    printf("Unique signatures: %zu\n", index->entry_count);
+
+    int rc = dictionary_snapshot_save(snap_file, dict, index);
+
+    hashtable_free(index);
+    dictionary_free(dict);
+
+    if (rc != 0)
+    {
+        fprintf(stderr, "Error: Failed to write snapshot '%s'\n", snap_file);
+        return 1;
+    }
+
+    timer_print("Snapshot compiled", start, timer_now());
+    return 0;
+}
+/**
+ * @brief Load a dictionary (snapshot or text) and build the index once
+ * @param dict_file Dictionary or snapshot path
+ * @param dict_out Receives the dictionary
+ * @param index_out Receives the query-ready index
+ * @return 0 on success, 1 on failure
+ */
+static int load_and_index(const char *dict_file, Dictionary **dict_out,
+                          HashTable **index_out)
+{
+    printf("Loading dictionary: %s\n", dict_file);
+    double load_start = timer_now();
+
+    Dictionary *dict = dictionary_create(INITIAL_CAPACITY);
+    if (!dict)
+    {
+        fprintf(stderr, "Error: Failed to create dictionary\n");
+        return 1;
+    }
+
+    HashTable *index = dictionary_snapshot_load(dict_file, dict);
+    int loaded = (int)dict->count;
+    if (!index)
+    {
+        loaded = load_dictionary_mmap(dict_file, dict);
+        if (loaded < 0)
+        {
+            loaded = load_dictionary(dict_file, dict);
+        }
+    }
+    if (loaded < 0)
+    {
+        dictionary_free(dict);
+        return 1;
+    }
+
+    timer_print("Dictionary loaded", load_start, timer_now());
+    printf("Words loaded: %zu\n", dict->count);
+
+    if (!index)
+    {
+        printf("\nBuilding index...\n");
+        double index_start = timer_now();
+        index = build_index(dict);
+        if (!index)
+        {
+            fprintf(stderr, "Error: Failed to build index\n");
+            dictionary_free(dict);
+            return 1;
+        }
+        timer_print("Index built", index_start, timer_now());
+    }
+    else
+    {
+        printf("\nIndex loaded from snapshot\n");
+    }
+    printf("Unique signatures: %zu\n", index->entry_count);
+
+    *dict_out = dict;
+    *index_out = index;
+    return 0;
+}
+
+/**
+ * @brief Answer a file of start words from one warm index
+ * @param dict_file Dictionary or snapshot path
+ * @param starts_file File with one start word per line
+ * @return 0 on success, 1 on failure
+ */
+static int run_batch_mode(const char *dict_file, const char *starts_file)
+{
+    Dictionary *dict = NULL;
+    HashTable *index = NULL;
+
+    if (load_and_index(dict_file, &dict, &index) != 0)
+    {
+        return 1;
+    }
+
+    /* Read the start words */
+    FILE *fp = fopen(starts_file, "r");
+    if (!fp)
+    {
+        fprintf(stderr, "Error: Cannot open starts file '%s'\n", starts_file);
+        hashtable_free(index);
+        dictionary_free(dict);
+        return 1;
+    }
+
+    char **starts = NULL;
+    size_t count = 0;
+    size_t capacity = 0;
+    char line[MAX_WORD_LENGTH + 2];
+
+    while (fgets(line, sizeof(line), fp))
+    {
+        size_t len = strcspn(line, "\r\n");
+        line[len] = '\0';
+        if (len == 0)
+        {
+            continue;
+        }
+
+        if (count >= capacity)
+        {
+            capacity = capacity ? capacity * 2 : 64;
+            char **grown = realloc(starts, capacity * sizeof(char *));
+            if (!grown)
+            {
+                break;
+            }
+            starts = grown;
+        }
+        starts[count] = strdup(line);
+        if (!starts[count])
+        {
+            break;
+        }
+        count++;
+    }
+    fclose(fp);
+
+    printf("\nRunning %zu queries from %s...\n", count, starts_file);
+    double batch_start = timer_now();
+    int resolved = find_longest_chains_batch(index, dict,
+                                             (const char **)starts, count);
+    timer_print("Batch completed", batch_start, timer_now());
+    printf("Queries answered: %d of %zu\n", resolved, count);
+
+    for (size_t i = 0; i < count; i++)
+    {
+        free(starts[i]);
+    }
+    free(starts);
+    hashtable_free(index);
+    dictionary_free(dict);
+
+    return resolved < 0 ? 1 : 0;
+}
+/**
+ * @brief Answer start words from stdin against one warm index
+ *
+ * Protocol: one start word per input line, one result line per query:
+ *   OK len=<L> chains=<N>: <words of the first chain>
+ *   ERR not found
+ * Lines are flushed per query so callers can pipeline over a pipe.
+ *
+ * @param dict_file Dictionary or snapshot path
+ * @return 0 on success, 1 on failure
+ */
+static int run_serve_mode(const char *dict_file)
+{
+    Dictionary *dict = NULL;
+    HashTable *index = NULL;
+
+    if (load_and_index(dict_file, &dict, &index) != 0)
+    {
+        return 1;
+    }
+
+    printf("READY\n");
+    fflush(stdout);
+
+    char line[MAX_WORD_LENGTH + 2];
+    while (fgets(line, sizeof(line), stdin))
+    {
+        line[strcspn(line, "\r\n")] = '\0';
+        if (line[0] == '\0')
+        {
+            continue;
+        }
+
+        ChainResults *res = find_longest_chains(index, dict, line);
+        if (!res)
+        {
+            printf("ERR not found\n");
+        }
+        else
+        {
+            printf("OK len=%zu chains=%zu:", res->max_length, res->count);
+            if (res->count > 0)
+            {
+                for (size_t i = 0; i < res->chains[0].length; i++)
+                {
+                    printf(" %s", dict->words[res->chains[0].indices[i]]);
+                }
+            }
+            printf("\n");
+            chain_results_free(res);
+        }
+        fflush(stdout);
+    }
+
+    hashtable_free(index);
+    dictionary_free(dict);
+
+    return 0;
+}
+#endif /* !IMPL_AI */
+
 int main(int argc, char *argv[])
 {
     /* Handle --help flag */
@@ -21,6 +285,76 @@ int main(int argc, char *argv[])
         return 0;
     }
 
+#if !defined(IMPL_AI)
+    int print_stats = 0;
+
+    /* Snapshot compile mode: parse + index once, serialize, exit */
+    if (argc == 4 && strcmp(argv[1], "--compile") == 0)
+    {
+        return run_compile_mode(argv[2], argv[3]);
+    }
+
+    /* Batch mode: load + index once, answer a file of start words */
+    if (argc == 4 && strcmp(argv[1], "--batch") == 0)
+    {
+        return run_batch_mode(argv[2], argv[3]);
+    }
+
+    /* Optional leading --threads N (dynamic memory mode only) */
+    if (argc >= 3 && strcmp(argv[1], "--threads") == 0)
+    {
+        search_set_threads(atoi(argv[2]));
+        argv += 2;
+        argc -= 2;
+    }
+
+    /* Optional --stats: print hot-path perf counters after the run */
+    if (argc >= 2 && strcmp(argv[1], "--stats") == 0)
+    {
+        print_stats = 1;
+        argv += 1;
+        argc -= 1;
+    }
+
+    /* Server mode: load + index once, answer stdin queries until EOF */
+    if (argc == 3 && strcmp(argv[1], "--serve") == 0)
+    {
+        return run_serve_mode(argv[2]);
+    }
+
+    /* Whole-dictionary mode: longest chain from any starting word */
+    if (argc == 3 && strcmp(argv[1], "--all") == 0)
+    {
+        Dictionary *all_dict = NULL;
+        HashTable *all_index = NULL;
+
+        if (load_and_index(argv[2], &all_dict, &all_index) != 0)
+        {
+            return 1;
+        }
+
+        printf("\nSearching for the longest chains from any word...\n");
+        double all_start = timer_now();
+        ChainResults *all_res = find_longest_chains_all(all_index, all_dict);
+        timer_print("Search completed", all_start, timer_now());
+
+        print_results(all_dict, all_res);
+
+        if (print_stats)
+        {
+            perf_stats_print();
+        }
+
+        chain_results_free(all_res);
+        hashtable_free(all_index);
+        dictionary_free(all_dict);
+#if defined(TRACE_BINARY)
+        trace_ring_drain();
+#endif
+        return 0;
+    }
+#endif
+
     /* Validate arguments */
     if (argc != 3)
     {
@@ -34,19 +368,27 @@ int main(int argc, char *argv[])
     /* Start total timer */
     double total_start = timer_now();
 
+    Dictionary *dict = NULL;
+    HashTable *index = NULL;
+
+#if !defined(IMPL_AI)
+    if (load_and_index(dict_file, &dict, &index) != 0)
+    {
+        return 1;
+    }
+#else
     /* Load dictionary */
     printf("Loading dictionary: %s\n", dict_file);
     double load_start = timer_now();
 
-    Dictionary *dict = dictionary_create(INITIAL_CAPACITY);
+    dict = dictionary_create(INITIAL_CAPACITY);
     if (!dict)
     {
         fprintf(stderr, "Error: Failed to create dictionary\n");
         return 1;
     }
 
-    int loaded = load_dictionary(dict_file, dict);
-    if (loaded < 0)
+    if (load_dictionary(dict_file, dict) < 0)
     {
         dictionary_free(dict);
         return 1;
@@ -55,19 +397,9 @@ int main(int argc, char *argv[])
     timer_print("Dictionary loaded", load_start, timer_now());
     printf("Words loaded: %zu\n", dict->count);
 
-    /* Verify start word exists */
-    if (find_word_index(dict, start_word) < 0)
-    {
-        fprintf(stderr, "Error: Starting word '%s' not found in dictionary\n",
-                start_word);
-        dictionary_free(dict);
-        return 1;
-    }
-
-    /* Build index */
     printf("\nBuilding index...\n");
     double index_start = timer_now();
-    HashTable *index = build_index(dict);
+    index = build_index(dict);
     if (!index)
     {
         fprintf(stderr, "Error: Failed to build index\n");
@@ -76,6 +408,17 @@ int main(int argc, char *argv[])
     }
     timer_print("Index built", index_start, timer_now());
     printf("Unique signatures: %zu\n", index->entry_count);
+#endif
+
+    /* Verify start word exists */
+    if (find_word_index(dict, start_word) < 0)
+    {
+        fprintf(stderr, "Error: Starting word '%s' not found in dictionary\n",
+                start_word);
+        hashtable_free(index);
+        dictionary_free(dict);
+        return 1;
+    }
 
     /* Find chains */
     printf("\nSearching for longest chains starting from '%s'...\n",
@@ -88,6 +431,13 @@ int main(int argc, char *argv[])
     /* Print results */
     print_results(dict, results);
 
+#if !defined(IMPL_AI)
+    if (print_stats)
+    {
+        perf_stats_print();
+    }
+#endif
+
     /* Print total time */
     double total_end = timer_now();
     printf("\nTotal execution time: ");
@@ -98,5 +448,9 @@ int main(int argc, char *argv[])
     hashtable_free(index);
     dictionary_free(dict);
 
+#if defined(TRACE_BINARY) && !defined(IMPL_AI)
+    trace_ring_drain();
+#endif
+
     return 0;
 }
@@ -0,0 +1,316 @@
+/**
+ * @file bench_main.c
+ * @brief In-process microbenchmarks for the human implementation
+ *
+ * benchmark.py measures whole-process wall time, where allocator noise,
+ * dictionary load and output drown out the code being tuned. This harness
+ * times individual primitives over many iterations with timer_now(). It
+ * includes the core translation unit directly, so the static helpers are
+ * measured with the same inlining the real build gets.
+ *
+ * Build and run: make bench (PC only, human implementation)
+ */
+
+#include "../src/impl/human/anagram_chain_core.c"
+
+#define BENCH_DICT_WORDS   20000
+#define BENCH_WORD_MAX     16
+#define BENCH_CHAIN_COUNT  200
+#define BENCH_CHAIN_LENGTH 12
+
+/* Deterministic corpus so runs are comparable across builds */
+static char g_bench_words[BENCH_DICT_WORDS][BENCH_WORD_MAX];
+static char g_bench_miss[BENCH_DICT_WORDS][BENCH_WORD_MAX + 2];
+
+/* Results are folded in here so the compiler cannot discard the work */
+static volatile unsigned long g_bench_sink;
+
+static uint32_t g_bench_rng = 0x12345u;
+
+/* xorshift32 - fixed seed, no libc rand() state to worry about */
+static uint32_t bench_rand(void)
+{
+    uint32_t x = g_bench_rng;
+
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    g_bench_rng = x;
+
+    return x;
+}
+
+static void bench_make_word(char *dst, size_t len)
+{
+    size_t i;
+
+    for (i = 0; i < len; i++)
+    {
+        dst[i] = (char)('a' + bench_rand() % 26);
+    }
+    dst[len] = '\0';
+}
+
+static void bench_report(const char *name, unsigned long iters,
+                         double start_ms, double end_ms)
+{
+    double total = end_ms - start_ms;
+
+    printf("  %-22s %9lu iters %9.1f ms %11.1f ns/op\n", name, iters, total,
+           total * 1e6 / (double)iters);
+}
+
+static void bench_setup_corpus(void)
+{
+    size_t i;
+    size_t len;
+
+    for (i = 0; i < BENCH_DICT_WORDS; i++)
+    {
+        len = 4 + bench_rand() % 10;
+        bench_make_word(g_bench_words[i], len);
+
+        /* Corpus words are a-z only, so a signature containing '{' can
+         * never be in the index - a guaranteed miss probe */
+        memcpy(g_bench_miss[i], g_bench_words[i], len);
+        sort_chars(g_bench_miss[i], len);
+        g_bench_miss[i][len] = '{';
+        g_bench_miss[i][len + 1] = '\0';
+    }
+}
+
+static void bench_sort_chars(void)
+{
+    enum
+    {
+        ITERS = 1000000
+    };
+    char buf[BENCH_WORD_MAX];
+    double start;
+    double end;
+    int i;
+
+    start = timer_now();
+    for (i = 0; i < ITERS; i++)
+    {
+        memcpy(buf, g_bench_words[i % BENCH_DICT_WORDS], sizeof(buf));
+        sort_chars(buf, strlen(buf));
+        g_bench_sink += (unsigned long)(unsigned char)buf[0];
+    }
+    end = timer_now();
+
+    bench_report("sort_chars", ITERS, start, end);
+}
+
+static void bench_insert_sorted(void)
+{
+    enum
+    {
+        ITERS = 1000000
+    };
+    char sig[BENCH_WORD_MAX];
+    char dst[BENCH_WORD_MAX + 2];
+    size_t len;
+    double start;
+    double end;
+    int i;
+
+    memcpy(sig, g_bench_words[0], sizeof(sig));
+    len = strlen(sig);
+    sort_chars(sig, len);
+
+    start = timer_now();
+    for (i = 0; i < ITERS; i++)
+    {
+        insert_sorted(dst, sig, len, (char)('a' + i % 26));
+        g_bench_sink += (unsigned long)(unsigned char)dst[0];
+    }
+    end = timer_now();
+
+    bench_report("insert_sorted", ITERS, start, end);
+}
+
+static void bench_hash_fnv1a(void)
+{
+    enum
+    {
+        ITERS = 1000000
+    };
+    double start;
+    double end;
+    int i;
+
+    start = timer_now();
+    for (i = 0; i < ITERS; i++)
+    {
+        g_bench_sink += hash_fnv1a(g_bench_words[i % BENCH_DICT_WORDS]);
+    }
+    end = timer_now();
+
+    bench_report("hash_fnv1a", ITERS, start, end);
+}
+
+static void bench_dictionary_add(Dictionary *dict)
+{
+    double start;
+    double end;
+    size_t i;
+
+    start = timer_now();
+    for (i = 0; i < BENCH_DICT_WORDS; i++)
+    {
+        dictionary_add(dict, g_bench_words[i]);
+    }
+    end = timer_now();
+
+    bench_report("dictionary_add", BENCH_DICT_WORDS, start, end);
+}
+
+static void bench_hashtable_find(HashTable *ht, Dictionary *dict)
+{
+    enum
+    {
+        ITERS = 1000000
+    };
+    double start;
+    double end;
+    int i;
+
+    start = timer_now();
+    for (i = 0; i < ITERS; i++)
+    {
+        g_bench_sink +=
+            (hashtable_find(ht, dict->signatures[i % dict->count]) != NULL);
+    }
+    end = timer_now();
+
+    bench_report("hashtable_find hit", ITERS, start, end);
+
+    start = timer_now();
+    for (i = 0; i < ITERS; i++)
+    {
+        g_bench_sink +=
+            (hashtable_find(ht, g_bench_miss[i % BENCH_DICT_WORDS]) != NULL);
+    }
+    end = timer_now();
+
+    bench_report("hashtable_find miss", ITERS, start, end);
+}
+
+/* Populate a dictionary with derived-anagram chains built by appending one
+ * random letter per step; returns the start word of the first chain. */
+static void bench_make_chain_dict(Dictionary *dict, char *start_out)
+{
+    char word[BENCH_CHAIN_LENGTH + 2];
+    size_t len;
+    int s;
+
+    for (s = 0; s < BENCH_CHAIN_COUNT; s++)
+    {
+        len = 2;
+        bench_make_word(word, len);
+        if (s == 0)
+        {
+            strcpy(start_out, word);
+        }
+
+        while (len <= BENCH_CHAIN_LENGTH)
+        {
+            dictionary_add(dict, word);
+            word[len] = (char)('a' + bench_rand() % 26);
+            len++;
+            word[len] = '\0';
+        }
+    }
+}
+
+static void bench_find_longest_chains(HashTable *ht, Dictionary *dict,
+                                      const char *start_word)
+{
+    enum
+    {
+        ITERS = 100
+    };
+    ChainResults *res;
+    double start;
+    double end;
+    int i;
+
+    start = timer_now();
+    for (i = 0; i < ITERS; i++)
+    {
+        res = find_longest_chains(ht, dict, start_word);
+        if (res)
+        {
+            g_bench_sink += res->max_length;
+            chain_results_free(res);
+        }
+    }
+    end = timer_now();
+
+    bench_report("find_longest_chains", ITERS, start, end);
+}
+
+int main(void)
+{
+    Dictionary *dict;
+    HashTable *ht;
+    char start_word[BENCH_CHAIN_LENGTH + 2];
+
+#if defined(USE_DYNAMIC_MEMORY)
+    printf("Microbenchmarks (impl=human, mem=dynamic)\n\n");
+#else
+    printf("Microbenchmarks (impl=human, mem=static)\n\n");
+#endif
+
+    bench_setup_corpus();
+
+    /* Standalone primitives */
+    bench_sort_chars();
+    bench_insert_sorted();
+    bench_hash_fnv1a();
+
+    /* Random-word dictionary: add throughput and index lookups */
+    dict = dictionary_create(INITIAL_CAPACITY);
+    if (!dict)
+    {
+        fprintf(stderr, "bench: dictionary_create failed\n");
+        return 1;
+    }
+    bench_dictionary_add(dict);
+
+    ht = build_index(dict);
+    if (!ht)
+    {
+        fprintf(stderr, "bench: build_index failed\n");
+        dictionary_free(dict);
+        return 1;
+    }
+    bench_hashtable_find(ht, dict);
+    hashtable_free(ht);
+    dictionary_free(dict);
+
+    /* Chain-rich dictionary: the end-to-end search without any I/O */
+    dict = dictionary_create(INITIAL_CAPACITY);
+    if (!dict)
+    {
+        fprintf(stderr, "bench: dictionary_create failed\n");
+        return 1;
+    }
+    bench_make_chain_dict(dict, start_word);
+
+    ht = build_index(dict);
+    if (!ht)
+    {
+        fprintf(stderr, "bench: build_index failed\n");
+        dictionary_free(dict);
+        return 1;
+    }
+    bench_find_longest_chains(ht, dict, start_word);
+    hashtable_free(ht);
+    dictionary_free(dict);
+
+    printf("\nDone (sink=%lu)\n", g_bench_sink);
+
+    return 0;
+}
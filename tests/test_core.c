@@ -60,6 +60,20 @@ int test_example_chain(void)
     return 0;
 }
 
+#if !defined(PLATFORM_ARM) && !defined(IMPL_AI)
+int test_load_dictionary_mmap(void)
+{
+    TEST_SKIP("load_dictionary_mmap", "stub implementation");
+    return 0;
+}
+
+int test_snapshot_roundtrip(void)
+{
+    TEST_SKIP("snapshot_roundtrip", "stub implementation");
+    return 0;
+}
+#endif /* !PLATFORM_ARM && !IMPL_AI */
+
 #if !defined(PLATFORM_ARM)
 int test_performance_small(void)
 {
@@ -322,6 +336,188 @@ int test_example_chain(void)
     return 0;
 }
 
+/* ============================================================================
+ * Unit Tests: Streaming Chain Iterator (human implementation)
+ * ============================================================================
+ */
+
+#if !defined(IMPL_AI)
+
+typedef struct
+{
+    size_t calls;
+    size_t max_length;
+    size_t stop_after; /* 0 = never stop */
+} StreamProbe;
+
+static int stream_probe_cb(const size_t *indices, size_t length, void *user)
+{
+    StreamProbe *probe = (StreamProbe *)user;
+
+    (void)indices;
+
+    probe->calls++;
+    if (length > probe->max_length)
+    {
+        probe->max_length = length;
+    }
+
+    return probe->stop_after && probe->calls >= probe->stop_after;
+}
+
+int test_chain_stream(void)
+{
+    const char *name = "chain_stream";
+
+    Dictionary *dict = dictionary_create(16);
+    if (!dict)
+    {
+        TEST_SKIP(name, "not implemented");
+        return 0;
+    }
+
+    const char *words[] = {"abcdg",  "abcd",     "abcdgh", "abcek",
+                           "abck",   "abc",      "abcdp",  "abcdghi",
+                           "bafced", "akjpqwmn", "abcelk", "baclekt"};
+
+    for (int i = 0; i < 12; i++)
+    {
+        dictionary_add(dict, words[i]);
+    }
+
+    HashTable *index = build_index(dict);
+    ASSERT_TRUE(index != NULL, name, "build_index failed");
+
+    /* From "abc": abcd->abcdg->abcdgh->abcdghi, abcd->abcdp and
+     * abck->abcek->abcelk->baclekt - three maximal chains, longest 5 */
+    StreamProbe probe = {0, 0, 0};
+    int n = find_chains_stream(index, dict, "abc", stream_probe_cb, &probe);
+    ASSERT_EQ(n, 3, name, "should stream 3 maximal chains");
+    ASSERT_EQ(probe.calls, 3, name, "callback count should match");
+    ASSERT_EQ(probe.max_length, 5, name, "longest maximal chain should be 5");
+
+    /* The stop code must end the search after the first chain */
+    probe.calls = 0;
+    probe.max_length = 0;
+    probe.stop_after = 1;
+    n = find_chains_stream(index, dict, "abc", stream_probe_cb, &probe);
+    ASSERT_EQ(n, 1, name, "stop code should end the search");
+
+    /* Unknown start word is an error, not an empty stream */
+    n = find_chains_stream(index, dict, "nosuchword", stream_probe_cb,
+                           &probe);
+    ASSERT_EQ(n, -1, name, "unknown start word should return -1");
+
+    hashtable_free(index);
+    dictionary_free(dict);
+
+    TEST_PASS(name);
+    return 0;
+}
+
+#endif /* !IMPL_AI */
+
+/* ============================================================================
+ * Unit Tests: mmap Dictionary Loading (PC only, human implementation)
+ * ============================================================================
+ */
+
+#if !defined(PLATFORM_ARM) && !defined(IMPL_AI)
+
+int test_load_dictionary_mmap(void)
+{
+    const char *name = "load_dictionary_mmap";
+
+    Dictionary *dict = dictionary_create(16);
+    if (!dict)
+    {
+        TEST_SKIP(name, "not implemented");
+        return 0;
+    }
+
+    int loaded = load_dictionary_mmap("tests/data/example.txt", dict);
+    if (loaded < 0)
+    {
+        TEST_SKIP(name, "test file not found");
+        dictionary_free(dict);
+        return 0;
+    }
+
+    ASSERT_EQ(loaded, 12, name, "should load all 12 example words");
+    ASSERT_EQ(dict->count, 12, name, "dict count should match");
+    ASSERT_TRUE(find_word_index(dict, "abck") >= 0, name,
+                "abck should be loadable via mmap path");
+
+    /* The zero-copy words must behave identically to the fgets path */
+    HashTable *index = build_index(dict);
+    ChainResults *results = find_longest_chains(index, dict, "abck");
+    ASSERT_TRUE(results != NULL, name, "search on mmap-loaded dict failed");
+    ASSERT_EQ(results->max_length, 4, name, "longest chain should be 4");
+
+    chain_results_free(results);
+    hashtable_free(index);
+    dictionary_free(dict);
+
+    TEST_PASS(name);
+    return 0;
+}
+
+int test_snapshot_roundtrip(void)
+{
+    const char *name = "snapshot_roundtrip";
+
+    Dictionary *dict = dictionary_create(16);
+    if (!dict)
+    {
+        TEST_SKIP(name, "not implemented");
+        return 0;
+    }
+
+    int loaded = load_dictionary("tests/data/example.txt", dict);
+    if (loaded < 0)
+    {
+        TEST_SKIP(name, "test file not found");
+        dictionary_free(dict);
+        return 0;
+    }
+
+    HashTable *index = build_index(dict);
+
+    if (dictionary_snapshot_save("build/test_snapshot.snap", dict, index) !=
+        0)
+    {
+        /* Static memory mode has no snapshot support */
+        TEST_SKIP(name, "snapshots not supported in this build");
+        hashtable_free(index);
+        dictionary_free(dict);
+        return 0;
+    }
+
+    hashtable_free(index);
+    dictionary_free(dict);
+
+    /* Reload from the snapshot and verify it is query-ready */
+    dict = dictionary_create(16);
+    index = dictionary_snapshot_load("build/test_snapshot.snap", dict);
+    ASSERT_TRUE(index != NULL, name, "snapshot load failed");
+    ASSERT_EQ(dict->count, 12, name, "snapshot word count mismatch");
+
+    ChainResults *results = find_longest_chains(index, dict, "abck");
+    ASSERT_TRUE(results != NULL, name, "search on snapshot failed");
+    ASSERT_EQ(results->max_length, 4, name, "longest chain should be 4");
+
+    chain_results_free(results);
+    hashtable_free(index);
+    dictionary_free(dict);
+
+    remove("build/test_snapshot.snap");
+
+    TEST_PASS(name);
+    return 0;
+}
+
+#endif /* !PLATFORM_ARM && !IMPL_AI */
+
 /* ============================================================================
  * Performance Tests (PC only - require file system)
  * ============================================================================
@@ -458,6 +654,15 @@ int run_all_tests(void)
 
     test_puts("\nIntegration Tests:\n");
     failures += test_example_chain();
+#if !defined(IMPL_AI)
+    failures += test_chain_stream();
+#endif
+
+#if !defined(PLATFORM_ARM) && !defined(IMPL_AI)
+    test_puts("\nFile Loading Tests:\n");
+    failures += test_load_dictionary_mmap();
+    failures += test_snapshot_roundtrip();
+#endif
 
 #if !defined(PLATFORM_ARM)
     test_puts("\nPerformance Tests:\n");
@@ -105,6 +105,12 @@ int test_performance_small(void);
 int test_performance_example(void);
 #endif
 
+/* mmap loader and snapshot tests (PC only, human implementation) */
+#if !defined(PLATFORM_ARM) && !defined(IMPL_AI)
+int test_load_dictionary_mmap(void);
+int test_snapshot_roundtrip(void);
+#endif
+
 /**
  * @brief Run all tests and return number of failures
  */